@@ -5,9 +5,12 @@
  * theological concepts of God using C code structures and functions,
  * including a calculation of the end of the world.
  * 
- * Compile with: gcc -Wall -Wextra -std=c99 -o god god.c -lm
+ * This file is libgod; the simulation demo lives in main.c. Build both
+ * with CMake (see CMakeLists.txt) or the Makefile wrapper: make release
  */
 
+#define _POSIX_C_SOURCE 200809L // strdup, clock_gettime, pthreads
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
@@ -15,178 +18,80 @@
 #include <limits.h>
 #include <float.h>
 #include <string.h>
+#include <stdint.h>
 #include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-/* Define symbolic infinity representations */
-#define INFINITY_REPRESENTATION DBL_MAX
-#define SYMBOLIC_ABSOLUTE_INFINITY -1  // Special sentinel value representing the concept
-#define SECONDS_PER_DAY (24 * 60 * 60) // Seconds in a day
-#define MAX_PRAYER_LENGTH 1024         // Maximum prayer length
-#define MAX_NAME_LENGTH 256            // Maximum entity name length
-
-/* Forward declarations for universe and time structures */
-typedef struct Universe Universe;
-typedef struct TimePoint TimePoint;
-typedef struct Proposition Proposition;
-typedef struct State State;
-typedef struct ConsciousEntity ConsciousEntity;
-typedef struct God God;
-
-/* Function prototypes */
-bool alwaysTrue(void);
-bool omniscienceFunction(const Proposition* p);
-bool omnipotenceFunction(const State* s);
-double divineLove(const ConsciousEntity* e);
-void* divineRevelation(const Universe* u, const TimePoint* t);
-bool divineOntoDependence(const void* existent);
-Universe* divineCompletion(const Universe* u);
-void* divineMultiverseProjection(const void* multiverse);
-double* divinePhysicalConstants(int numConstants);
-bool trinityEquality(const void* p1, const void* p2);
-void divineProjectIntoSpace(const void* space);
-void divineProjectIntoTime(const TimePoint* t);
-double divineJusticeEvaluation(void* moralFramework);
-bool divineFreeWillCompatibility(const ConsciousEntity* e, void* choice);
-Universe* divineMiracle(const Universe* u, const TimePoint* t);
-Universe* divinePrayerResponse(const ConsciousEntity* pray_er, const char* prayer, const Universe* u);
-Universe* divineCreateUniverse(void);
-char* formPrayer(ConsciousEntity* entity);
-long calculateEndOfWorld(const Universe* universe);
-void freeUniverse(Universe* u);
-void freeGod(God* g);
-double universeEvolveFunction(const TimePoint* t);
-bool entityMakeChoice(const State* options);
-void freeRevelation(void* revelation);
-void freeProjection(void* projection);
-
-/* The God structure - an attempt to formalize divine attributes */
-struct God {
-    /* TRANSCENDENCE: Cannot be fully contained in any universe */
-    void* transcendence; // Conceptual pointer to something outside our memory space
-    
-    /* OMNIPRESENCE: Present throughout all existence */
-    void (*projectIntoSpace)(const void* space);
-    
-    /* OMNISCIENCE: Perfect knowledge of all truths */
-    bool (*knowsTruth)(const Proposition* p);
-    
-    /* OMNIPOTENCE: Power to actualize any logically consistent state */
-    bool (*canActualize)(const State* s);
-    
-    /* INFINITY: Exceeds any definable cardinality */
-    double infinityMeasure; // Conceptual approximation
-    
-    /* UNITY: Fundamentally indivisible */
-    bool isSeparable; // Always false
-    
-    /* CREATION: Source of existence */
-    Universe* (*createUniverse)(void);
-    
-    /* LOVE: Maximum positive connection to all entities */
-    double (*loveIntensityFor)(const ConsciousEntity* e);
-    
-    /* JUSTICE: Perfect moral rightness */
-    double (*justiceEvaluation)(void* moralFramework);
-    
-    /* MYSTERY: Contains elements beyond formal description */
-    void* incompletenessAspect; // Represents Gödel's incompleteness
-    
-    /* SELF-EXISTENCE: Necessary existence */
-    bool (*exists)(void); // Always returns true for God
-    
-    /* ATEMPORALITY: Exists outside time */
-    void (*projectIntoTime)(const TimePoint* t);
-    
-    /* PERFECT INFORMATION: No entropy or disorder */
-    double entropy; // Always 0
-    
-    /* TRINITY: For trinitarian concepts */
-    struct {
-        void* person1;
-        void* person2;
-        void* person3;
-        bool (*areEqual)(const void* p1, const void* p2);
-        int count; // Always 1, paradoxically
-    } trinity;
-    
-    /* FREE WILL COMPATIBILITY */
-    bool (*compatibleWithFreeWill)(const ConsciousEntity* e, void* choice);
-    
-    /* MIRACLE FUNCTION: Can intervene in natural laws */
-    Universe* (*performMiracle)(const Universe* u, const TimePoint* t);
-    
-    /* PRAYER RESPONSE: Responds to prayers */
-    Universe* (*respondToPrayer)(const ConsciousEntity* pray_er, const char* prayer, const Universe* u);
-    
-    /* REVELATION: Self-discloses in comprehensible ways */
-    void* (*reveal)(const Universe* u, const TimePoint* t);
-    
-    /* GROUND OF BEING: Ontological foundation */
-    bool (*isOntoDependent)(const void* existent);
-    
-    /* ULTIMATE VALUE: Supreme good */
-    double value; // Maximum possible
-    
-    /* TELEOLOGICAL COMPLETION: History's fulfillment */
-    Universe* (*completeUniverse)(const Universe* u);
-    
-    /* MULTIVERSE SPANNING: Transcends all possible universes */
-    void* (*projectIntoMultiverse)(const void* multiverse);
-    
-    /* PHYSICAL CONSTANT DETERMINATION */
-    double* (*determinePhysicalConstants)(int numConstants);
-    
-    /* ESCHATOLOGY: Knowledge of the end of time */
-    long (*daysToEndOfWorld)(const Universe* u);
-};
+#include "god.h"
 
-/* Structure for a universe with physical laws */
-struct Universe {
-    double* physicalConstants;
-    int numConstants;
-    void* matter;
-    void* energy;
-    void* spacetime;
-    ConsciousEntity** consciousEntities;
-    int numEntities;
-    struct {
-        double (*evolve)(const TimePoint* t);
-    } naturalLaws;
-    
-    /* Universe age and lifespan */
-    time_t creationTime;
-    long totalLifespanDays;
-    double entropyLevel;  // Current entropy level
-    double maxEntropy;    // Maximum entropy at heat death
-};
+/* x86 SIMD kernels, selected at runtime by CPU feature */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GOD_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define GOD_X86_SIMD 0
+#endif
 
-/* Structure for a proposition */
-struct Proposition {
-    char* statement;
-    bool truthValue;
-};
+#if defined(__GNUC__)
+#define GOD_CACHE_ALIGNED __attribute__((aligned(CACHE_LINE_SIZE)))
+#else
+#define GOD_CACHE_ALIGNED
+#endif
 
-/* Structure for a possible state of reality */
-struct State {
-    Universe* universe;
-    TimePoint* time;
-    bool isLogicallyConsistent;
-};
+/* Library internals */
+#define SECONDS_PER_DAY (24 * 60 * 60) // Seconds in a day
+#define ESCHATOLOGY_CONSTANTS 10       // Physical constants that weigh on the end of the world
+#define ESCHATOLOGICAL_CONSTANT 0.12345 // Divine mystery number
+#define ESCHATOLOGY_BLOCK 8            // Universes per SIMD end-of-world block
+#define PRAYER_PREFIX "Prayer from "   // Every prayer is PREFIX name SUFFIX
+#define PRAYER_SUFFIX ": Please guide me."
+#define PAYLOAD_IMMORTAL -1            // Reference count of static payloads, never freed
+#define CACHE_LINE_SIZE 64
+#define SCHEDULER_DEQUE_SIZE 64        // Tasks per worker deque - ranges are split at most 64 times deep
+#define PRAYER_SWEEP_GRAIN 256         // Entities per prayer sweep task
+#define PRAYER_QUEUE_BATCH 64          // Prayers the consumer takes off the queue at once
+#define EVOLVE_BATCH 256               // Time points handed to evolveBatch at once
+#define PRAYER_INTENT_PREFILTER 8      // Most distinct first bytes the SIMD prefilter compares against
+#define ENTITY_SLAB_MIN 64             // Smallest slab of entity records
+#define NAME_POOL_MIN 1024             // Smallest entity name pool in bytes
+#define HASH_INDEX_MIN 16              // Smallest name or knowledge index in slots
+#define KNOWLEDGE_MIN 1024             // Statements a knowledge base first makes room for
+#define NAME_LOOKUP_PREFETCH 8         // Names a bulk lookup hashes ahead of the one it probes
+#define SNAPSHOT_MAGIC "GODSNAP"       // First 8 bytes of a universe snapshot, NUL included
+#define SNAPSHOT_VERSION 2
+#define SNAPSHOT_BYTE_ORDER 0x01020304u // Reads back differently on a host of the other byte order
+#define SNAPSHOT_ALIGNMENT 64          // Sections start on cache lines
+#define MULTIVERSE_GRAIN 1024          // Universes per multiverse task
+#define SNAPSHOT_FIXUP_GRAIN 65536     // Entity records per snapshot fix-up task
+#define SNAPSHOT_INDEX_BLOCK 65536     // Name index slots per snapshot validation task
+#define LATENCY_SUB_BITS 4             // Histogram buckets split each power of two in 16 - within 6.25%
+#define LATENCY_MAX_EXPONENT 47        // Latencies are clamped to 2^48 ns, about three days
+#define LATENCY_BUCKETS ((LATENCY_MAX_EXPONENT - LATENCY_SUB_BITS + 2) << LATENCY_SUB_BITS)
 
-/* Time structure */
-struct TimePoint {
-    double temporalCoordinate;
-    bool isInEternity;
-};
+/* Arena block header - one reference for the resident universe, one per live payload array */
+typedef struct UniverseArena {
+    long refCount;
+} UniverseArena;
+
+/* Header in front of every payload array, which forks share until one of them writes
+ * Reference counts are updated atomically, so threads may fork the same universe */
+typedef struct PayloadHeader {
+    long refCount;         // Universes referencing the array, or PAYLOAD_IMMORTAL
+    UniverseArena* arena;  // Arena block holding the array, NULL if allocated on its own
+} PayloadHeader;
 
-/* Structure for beings with consciousness */
-struct ConsciousEntity {
-    void* consciousness;
-    void* freeWill;
-    char* name;
-    bool (*makeChoice)(const State* options);
-    char* (*formPrayer)(struct ConsciousEntity* self);
-    int uniqueId; // To differentiate entities
+/* Slab of entity records - slabs grow geometrically, so a whole population
+ * is released with a handful of frees */
+struct EntitySlab {
+    EntitySlab* next;
+    int used;
+    int capacity;
+    ConsciousEntity entities[];
 };
 
 /**
@@ -197,6 +102,67 @@ double universeEvolveFunction(const TimePoint* t) {
     return t->temporalCoordinate * 0.1; // Simplified evolution function
 }
 
+#if GOD_X86_SIMD
+/**
+ * AVX2 kernel of universeEvolveBatchFunction - four time points per vector
+ * A TimePoint is two 8-byte words, its coordinate first, so two loads
+ * hold four coordinates in their even words.
+ */
+__attribute__((target("avx2")))
+static void universeEvolveBatchAvx2(const TimePoint* t, int count, double* evolution) {
+    const __m256d rate = _mm256_set1_pd(0.1);
+    
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d low = _mm256_loadu_pd(&t[i].temporalCoordinate);     // c0 . c1 .
+        __m256d high = _mm256_loadu_pd(&t[i + 2].temporalCoordinate); // c2 . c3 .
+        __m256d coordinates = _mm256_permute4x64_pd(_mm256_unpacklo_pd(low, high), 0xD8);
+        _mm256_storeu_pd(&evolution[i], _mm256_mul_pd(coordinates, rate));
+    }
+    for (; i < count; i++) {
+        evolution[i] = t[i].temporalCoordinate * 0.1;
+    }
+}
+#endif /* GOD_X86_SIMD */
+
+static void universeEvolveBatchScalar(const TimePoint* t, int count, double* evolution) {
+    for (int i = 0; i < count; i++) {
+        evolution[i] = t[i].temporalCoordinate * 0.1;
+    }
+}
+
+typedef void (*EvolveBatchKernel)(const TimePoint* t, int count, double* evolution);
+
+/**
+ * Widest evolution kernel this CPU runs
+ */
+static EvolveBatchKernel selectEvolveBatchKernel(void) {
+#if GOD_X86_SIMD
+    __builtin_cpu_init();
+    if (sizeof(TimePoint) == 2 * sizeof(double) && __builtin_cpu_supports("avx2")) {
+        return &universeEvolveBatchAvx2;
+    }
+#endif
+    return &universeEvolveBatchScalar;
+}
+
+/**
+ * Universe natural law evolution over `count` time points at once -
+ * evolution[i] is universeEvolveFunction(&t[i])
+ */
+void universeEvolveBatchFunction(const TimePoint* t, int count, double* evolution) {
+    // Resolved on the first call; racing first calls store the same kernel
+    static EvolveBatchKernel kernel = NULL;
+    if (!t || !evolution || count <= 0) return;
+    
+    EvolveBatchKernel run = __atomic_load_n(&kernel, __ATOMIC_RELAXED);
+    if (!run) {
+        run = selectEvolveBatchKernel();
+        __atomic_store_n(&kernel, run, __ATOMIC_RELAXED);
+    }
+    run(t, count, evolution);
+}
+
 /**
  * Entity choice function
  */
@@ -205,19 +171,131 @@ bool entityMakeChoice(const State* options) {
     return options->isLogicallyConsistent; // Simplified choice function
 }
 
+/* The divine clock - source of "now" for creation and eschatology
+ * Read from scheduler workers and multiverse batches while the caller may
+ * switch modes or open ticks, so every field is read and written atomically.
+ * A reading taken while the clock is being changed sees either the old
+ * setting or the new one. */
+static struct {
+    DivineClockMode mode;
+    time_t fixedNow;  // Instant of DIVINE_CLOCK_FIXED
+    time_t tickNow;   // Instant cached by the open tick
+    bool inTick;
+} divineClock = { DIVINE_CLOCK_REALTIME, 0, 0, false };
+
 /**
- * Calculate days until the end of the world based on universe parameters
- * This is where the divine knowledge of eschatology is implemented
+ * Choose where the divine clock reads the time from
  */
-long calculateEndOfWorld(const Universe* universe) {
-    if (!universe) return -1;
+void divineClockUse(DivineClockMode mode) {
+    __atomic_store_n(&divineClock.mode, mode, __ATOMIC_RELEASE);
+}
+
+/**
+ * Stop the divine clock at `now` - every reading returns it, for replays
+ */
+void divineClockSetFixed(time_t now) {
+    // The instant is published before the mode that makes readers use it
+    __atomic_store_n(&divineClock.fixedNow, now, __ATOMIC_RELAXED);
+    __atomic_store_n(&divineClock.mode, DIVINE_CLOCK_FIXED, __ATOMIC_RELEASE);
+}
+
+/**
+ * Read the configured clock source
+ */
+static time_t readDivineClockSource(void) {
+    switch (__atomic_load_n(&divineClock.mode, __ATOMIC_ACQUIRE)) {
+    case DIVINE_CLOCK_FIXED:
+        return __atomic_load_n(&divineClock.fixedNow, __ATOMIC_RELAXED);
+    case DIVINE_CLOCK_REALTIME_COARSE: {
+#ifdef CLOCK_REALTIME_COARSE
+        // Served from the last timer tick, without reading the hardware clock
+        struct timespec ts;
+        if (clock_gettime(CLOCK_REALTIME_COARSE, &ts) == 0) return ts.tv_sec;
+#endif
+        break; // Not available here - fall back to the precise clock
+    }
+    case DIVINE_CLOCK_REALTIME:
+        break;
+    }
+    
+    time_t now;
+    time(&now);
+    return now;
+}
+
+/**
+ * Open a tick: sample the clock once, and have every reading until
+ * divineClockEndTick return that instant
+ */
+void divineClockBeginTick(void) {
+    __atomic_store_n(&divineClock.tickNow, readDivineClockSource(), __ATOMIC_RELAXED);
+    __atomic_store_n(&divineClock.inTick, true, __ATOMIC_RELEASE);
+}
+
+/**
+ * Close the open tick - readings go back to the clock source
+ */
+void divineClockEndTick(void) {
+    __atomic_store_n(&divineClock.inTick, false, __ATOMIC_RELEASE);
+}
+
+/**
+ * Current time according to the divine clock
+ */
+time_t divineClockNow(void) {
+    if (__atomic_load_n(&divineClock.inTick, __ATOMIC_ACQUIRE)) {
+        return __atomic_load_n(&divineClock.tickNow, __ATOMIC_RELAXED);
+    }
+    
+    return readDivineClockSource();
+}
+
+/**
+ * Influence of the physical constants on the end of the world:
+ * a harmonic sum of the normalized first constants
+ */
+static double computePhysicalInfluence(const double* physicalConstants, int numConstants) {
+    // FIXED: prevent numerical instability
+    double physicalInfluence = 0.0;
+    for (int i = 0; i < numConstants && i < ESCHATOLOGY_CONSTANTS; i++) {
+        // Limit to first 10 constants and use a more stable algorithm
+        double normalizedConstant = physicalConstants[i] / 
+                                    (fabs(physicalConstants[i]) + 1.0);
+        physicalInfluence += normalizedConstant / (double)(i + 1);
+    }
+    // Scale to a reasonable range
+    return fmod(fabs(physicalInfluence), 100.0);
+}
+
+/**
+ * Bring the cached physical influence of a universe up to date
+ * Called by the writers once a change to the constants is complete.
+ */
+static void refreshPhysicalInfluence(Universe* u) {
+    u->physicalInfluence = computePhysicalInfluence(u->physicalConstants, u->numConstants);
+    u->influenceVersion = u->constantsVersion;
+}
+
+/**
+ * Physical influence of a universe
+ * Readers never write the cache, so concurrent countdowns of one universe
+ * do not race; constants still being written through
+ * universeWritableConstants are evaluated afresh on each call.
+ */
+static double universePhysicalInfluence(const Universe* u) {
+    if (u->influenceVersion == u->constantsVersion) return u->physicalInfluence;
     
-    // Current time
-    time_t currentTime;
-    time(&currentTime);
+    return computePhysicalInfluence(u->physicalConstants, u->numConstants);
+}
+
+/**
+ * Days until the end of the world as seen at time `now`
+ */
+static long calculateEndOfWorldAt(const Universe* universe, time_t now) {
+    if (!universe) return -1;
     
     // Time since universe creation in seconds
-    double timeElapsedSeconds = difftime(currentTime, universe->creationTime);
+    double timeElapsedSeconds = difftime(now, universe->creationTime);
     // Convert to days - FIXED: now properly dividing by seconds per day
     double daysSinceCreation = timeElapsedSeconds / SECONDS_PER_DAY;
     
@@ -228,18 +306,9 @@ long calculateEndOfWorld(const Universe* universe) {
     
     // Apply nonlinear adjustment based on universe parameters
     // In theological terms, the end may come "like a thief in the night"
-    const double ESCHATOLOGICAL_CONSTANT = 0.12345;  // Divine mystery number
     
-    // Apply physical constants to the calculation - FIXED: prevent numerical instability
-    double physicalInfluence = 0.0;
-    for (int i = 0; i < universe->numConstants && i < 10; i++) {
-        // Limit to first 10 constants and use a more stable algorithm
-        double normalizedConstant = universe->physicalConstants[i] / 
-                                    (fabs(universe->physicalConstants[i]) + 1.0);
-        physicalInfluence += normalizedConstant / (double)(i + 1);
-    }
-    // Scale to a reasonable range
-    physicalInfluence = fmod(fabs(physicalInfluence), 100.0);
+    // Apply physical constants to the calculation - cached until they change
+    double physicalInfluence = universePhysicalInfluence(universe);
     
     // Calculate influence of conscious entities (moral dimension)
     // FIXED: prevent overflow with reasonable upper limit
@@ -256,6 +325,183 @@ long calculateEndOfWorld(const Universe* universe) {
     return (long)fmin((double)LONG_MAX, daysRemaining);
 }
 
+/**
+ * Calculate days until the end of the world based on universe parameters
+ * This is where the divine knowledge of eschatology is implemented
+ */
+long calculateEndOfWorld(const Universe* universe) {
+    if (!universe) return -1;
+    
+    // Current time - the tick's cached instant while a tick is open
+    return calculateEndOfWorldAt(universe, divineClockNow());
+}
+
+/* Inputs of the end-of-world calculation for a block of universes, one lane
+ * per universe, laid out so the SIMD kernels load each input with one load */
+typedef struct EschatologyBlock {
+    double physicalInfluence[ESCHATOLOGY_BLOCK];
+    double daysSinceCreation[ESCHATOLOGY_BLOCK];
+    double lifespanDays[ESCHATOLOGY_BLOCK];
+    double entropyLevel[ESCHATOLOGY_BLOCK];
+    double maxEntropy[ESCHATOLOGY_BLOCK];
+    double numEntities[ESCHATOLOGY_BLOCK];
+} EschatologyBlock;
+
+/* Computes the untruncated days remaining for every lane of a block */
+typedef void (*EschatologyKernel)(const EschatologyBlock* block, double* days);
+
+/**
+ * Gather up to ESCHATOLOGY_BLOCK universes into a block
+ * Missing lanes and NULL universes get harmless placeholder inputs
+ */
+static void stageEschatologyBlock(EschatologyBlock* block, const Universe* const* universes,
+                                  int lanes, time_t now) {
+    for (int lane = 0; lane < ESCHATOLOGY_BLOCK; lane++) {
+        const Universe* u = lane < lanes ? universes[lane] : NULL;
+        if (!u) {
+            block->physicalInfluence[lane] = 0.0;
+            block->daysSinceCreation[lane] = 0.0;
+            block->lifespanDays[lane] = 0.0;
+            block->entropyLevel[lane] = 0.0;
+            block->maxEntropy[lane] = 1.0;
+            block->numEntities[lane] = 0.0;
+            continue;
+        }
+        
+        block->physicalInfluence[lane] = universePhysicalInfluence(u);
+        block->daysSinceCreation[lane] = difftime(now, u->creationTime) / SECONDS_PER_DAY;
+        block->lifespanDays[lane] = (double)u->totalLifespanDays;
+        block->entropyLevel[lane] = u->entropyLevel;
+        block->maxEntropy[lane] = u->maxEntropy;
+        block->numEntities[lane] = (double)u->numEntities;
+    }
+}
+
+#if GOD_X86_SIMD
+/**
+ * AVX2 end-of-world kernel - four universes per vector
+ */
+__attribute__((target("avx2")))
+static void eschatologyKernelAvx2(const EschatologyBlock* block, double* days) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.0);
+    
+    for (int lane = 0; lane < ESCHATOLOGY_BLOCK; lane += 4) {
+        __m256d physicalInfluence = _mm256_loadu_pd(&block->physicalInfluence[lane]);
+        __m256d entropyRatio = _mm256_div_pd(_mm256_loadu_pd(&block->entropyLevel[lane]),
+                                             _mm256_loadu_pd(&block->maxEntropy[lane]));
+        // max(x, 0) yields 0 for NaN like fmax(0.0, x)
+        __m256d daysRemaining = _mm256_max_pd(_mm256_sub_pd(_mm256_loadu_pd(&block->lifespanDays[lane]),
+                                                            _mm256_loadu_pd(&block->daysSinceCreation[lane])),
+                                              zero);
+        __m256d consciousnessInfluence = _mm256_min_pd(
+            _mm256_mul_pd(_mm256_loadu_pd(&block->numEntities[lane]), _mm256_set1_pd(ESCHATOLOGICAL_CONSTANT)),
+            _mm256_set1_pd(1000.0));
+        
+        __m256d result = _mm256_sub_pd(_mm256_mul_pd(daysRemaining, _mm256_sub_pd(one, entropyRatio)),
+                                       _mm256_mul_pd(physicalInfluence, entropyRatio));
+        result = _mm256_max_pd(_mm256_add_pd(result, consciousnessInfluence), zero);
+        
+        _mm256_storeu_pd(&days[lane], result);
+    }
+}
+
+/**
+ * AVX-512 end-of-world kernel - a whole block per vector
+ */
+__attribute__((target("avx512f")))
+static void eschatologyKernelAvx512(const EschatologyBlock* block, double* days) {
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d one = _mm512_set1_pd(1.0);
+    
+    __m512d physicalInfluence = _mm512_loadu_pd(block->physicalInfluence);
+    __m512d entropyRatio = _mm512_div_pd(_mm512_loadu_pd(block->entropyLevel),
+                                         _mm512_loadu_pd(block->maxEntropy));
+    // max(x, 0) yields 0 for NaN like fmax(0.0, x)
+    __m512d daysRemaining = _mm512_max_pd(_mm512_sub_pd(_mm512_loadu_pd(block->lifespanDays),
+                                                        _mm512_loadu_pd(block->daysSinceCreation)),
+                                          zero);
+    __m512d consciousnessInfluence = _mm512_min_pd(
+        _mm512_mul_pd(_mm512_loadu_pd(block->numEntities), _mm512_set1_pd(ESCHATOLOGICAL_CONSTANT)),
+        _mm512_set1_pd(1000.0));
+    
+    __m512d result = _mm512_sub_pd(_mm512_mul_pd(daysRemaining, _mm512_sub_pd(one, entropyRatio)),
+                                   _mm512_mul_pd(physicalInfluence, entropyRatio));
+    result = _mm512_max_pd(_mm512_add_pd(result, consciousnessInfluence), zero);
+    
+    _mm512_storeu_pd(days, result);
+}
+#endif /* GOD_X86_SIMD */
+
+/**
+ * Widest end-of-world kernel this CPU runs, or NULL for the scalar path
+ */
+static EschatologyKernel selectEschatologyKernel(void) {
+#if GOD_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return &eschatologyKernelAvx512;
+    if (__builtin_cpu_supports("avx2")) return &eschatologyKernelAvx2;
+#endif
+    return NULL;
+}
+
+/**
+ * Days until the end of the world for `count` universes as seen at time
+ * `currentTime`, computed by `kernel` - NULL for the scalar path
+ */
+static void calculateEndOfWorldBatchWith(EschatologyKernel kernel, const Universe* const* universes,
+                                         int count, long* daysRemaining, time_t currentTime) {
+    if (!kernel) {
+        for (int i = 0; i < count; i++) {
+            daysRemaining[i] = calculateEndOfWorldAt(universes[i], currentTime);
+        }
+        return;
+    }
+    
+    EschatologyBlock block;
+    double days[ESCHATOLOGY_BLOCK];
+    for (int base = 0; base < count; base += ESCHATOLOGY_BLOCK) {
+        int lanes = count - base < ESCHATOLOGY_BLOCK ? count - base : ESCHATOLOGY_BLOCK;
+        stageEschatologyBlock(&block, universes + base, lanes, currentTime);
+        kernel(&block, days);
+        
+        for (int lane = 0; lane < lanes; lane++) {
+            daysRemaining[base + lane] = universes[base + lane]
+                ? (long)fmin((double)LONG_MAX, days[lane])
+                : -1;
+        }
+    }
+}
+
+/**
+ * Days until the end of the world for `count` universes as seen at time
+ * `currentTime`, with the widest kernel this CPU runs
+ */
+static void calculateEndOfWorldBatchAt(const Universe* const* universes, int count,
+                                       long* daysRemaining, time_t currentTime) {
+    calculateEndOfWorldBatchWith(selectEschatologyKernel(), universes, count, daysRemaining, currentTime);
+}
+
+/**
+ * Days until the end of the world for `count` universes at once
+ * All universes are judged at the same instant, read once from the divine
+ * clock. The AVX2/AVX-512 kernel is chosen at runtime, with the scalar
+ * calculateEndOfWorld as the fallback.
+ * The kernels perform the same IEEE operations in the same order as the
+ * scalar path and share its cached physical influence, so with
+ * floating-point contraction off (the ISO C default) results are
+ * identical. If the scalar path is compiled with FMA contraction, the
+ * untruncated day count may differ by 1 ULP, which changes the whole-day
+ * result only when it lies within 1 ULP of an integer.
+ * NULL universes yield -1.
+ */
+void calculateEndOfWorldBatch(const Universe* const* universes, int count, long* daysRemaining) {
+    if (!universes || !daysRemaining || count <= 0) return;
+    
+    // One instant for the whole batch
+    calculateEndOfWorldBatchAt(universes, count, daysRemaining, divineClockNow());
+}
+
 /**
  * Initialize God instance with divine attributes
  * Implementation of all function pointers for completeness
@@ -338,443 +584,3171 @@ God* createGod() {
 }
 
 /**
- * Creation function - metaphorical representation of God creating a universe
+ * Fill an array with the divinely chosen physical constants
  */
-Universe* divineCreateUniverse() {
-    // Create a new universe with physical laws
-    Universe* newUniverse = (Universe*)malloc(sizeof(Universe));
-    if (!newUniverse) return NULL;
-    
-    // Initialize with NULL values first in case we need to free on error
-    newUniverse->physicalConstants = NULL;
-    newUniverse->spacetime = NULL;
-    newUniverse->matter = NULL;
-    newUniverse->energy = NULL;
-    newUniverse->consciousEntities = NULL;
-    newUniverse->numEntities = 0;
+static void fillPhysicalConstants(double* constants, int numConstants) {
+    // Set some known physical constants (simplified)
+    constants[0] = 299792458.0;      // Speed of light (m/s)
     
-    // Set physical constants according to divine wisdom
-    newUniverse->numConstants = 30; // Fundamental constants of physics
-    newUniverse->physicalConstants = divinePhysicalConstants(newUniverse->numConstants);
-    if (!newUniverse->physicalConstants) {
-        free(newUniverse);
-        return NULL;
-    }
+    // Protect against potential array access out of bounds
+    if (numConstants > 1) constants[1] = 6.62607015e-34;   // Planck's constant (J⋅s)
+    if (numConstants > 2) constants[2] = 6.67430e-11;      // Gravitational constant (m³/kg⋅s²)
+    if (numConstants > 3) constants[3] = 8.8541878128e-12; // Vacuum permittivity (F/m)
     
-    // Instantiate spacetime with placeholder data
-    newUniverse->spacetime = malloc(sizeof(double) * 4); // 4D spacetime
-    if (!newUniverse->spacetime) {
-        free(newUniverse->physicalConstants);
-        free(newUniverse);
-        return NULL;
+    // Fill the rest with placeholder values
+    for (int i = 4; i < numConstants; i++) {
+        constants[i] = 1.0 / (i + 1); // Arbitrary values
     }
-    
-    double* spacetimeData = (double*)newUniverse->spacetime;
-    for (int i = 0; i < 4; i++) {
+}
+
+/* Process-wide default physical constants - filled by fillPhysicalConstants
+ * on first use, then shared read-only by every universe until it customizes
+ * them. The header sits right before the cache-aligned values like any payload. */
+static struct {
+    char padding[CACHE_LINE_SIZE - sizeof(PayloadHeader)];
+    PayloadHeader header;
+    double values[DEFAULT_NUM_CONSTANTS];
+} GOD_CACHE_ALIGNED defaultConstantsTable = { { 0 }, { PAYLOAD_IMMORTAL, NULL }, { 0 } };
+static double defaultPhysicalInfluence; // Of the default constants, so creation need not compute it
+static pthread_once_t defaultConstantsOnce = PTHREAD_ONCE_INIT;
+
+static void fillDefaultConstants(void) {
+    fillPhysicalConstants(defaultConstantsTable.values, DEFAULT_NUM_CONSTANTS);
+    defaultPhysicalInfluence = computePhysicalInfluence(defaultConstantsTable.values, DEFAULT_NUM_CONSTANTS);
+}
+
+/**
+ * Set the initial state of a freshly created universe whose spacetime,
+ * matter and energy are allocated
+ */
+static void initializeUniverseState(Universe* u) {
+    // Every universe starts out with the shared default constants
+    pthread_once(&defaultConstantsOnce, &fillDefaultConstants);
+    u->physicalConstants = defaultConstantsTable.values;
+    u->numConstants = DEFAULT_NUM_CONSTANTS;
+    u->constantsVersion = 1;
+    u->physicalInfluence = defaultPhysicalInfluence;
+    u->influenceVersion = u->constantsVersion;
+    
+    double* spacetimeData = (double*)u->spacetime;
+    for (int i = 0; i < SPACETIME_DIMENSIONS; i++) {
         spacetimeData[i] = 0.0; // Initial spacetime coordinates
     }
     
     // Create matter and energy from nothing - placeholder data
-    newUniverse->matter = malloc(sizeof(double));
-    if (!newUniverse->matter) {
-        free(newUniverse->spacetime);
-        free(newUniverse->physicalConstants);
-        free(newUniverse);
-        return NULL;
-    }
-    *(double*)(newUniverse->matter) = 1.0; // Initial matter content
-    
-    newUniverse->energy = malloc(sizeof(double));
-    if (!newUniverse->energy) {
-        free(newUniverse->matter);
-        free(newUniverse->spacetime);
-        free(newUniverse->physicalConstants);
-        free(newUniverse);
-        return NULL;
-    }
-    *(double*)(newUniverse->energy) = 1.0; // Initial energy content
+    *(double*)(u->matter) = 1.0; // Initial matter content
+    *(double*)(u->energy) = 1.0; // Initial energy content
     
     // Set natural law evolution function
-    newUniverse->naturalLaws.evolve = &universeEvolveFunction;
+    u->naturalLaws.evolve = &universeEvolveFunction;
+    u->naturalLaws.evolveBatch = &universeEvolveBatchFunction;
     
     // Set universe timespan and entropy parameters
-    time(&newUniverse->creationTime);  // Creation time is now
+    u->creationTime = divineClockNow();  // Creation time is now
     
     // Set universe lifespan parameters (for eschatological calculations)
-    newUniverse->totalLifespanDays = 5000 * 365;  // Example: 5000 years in days
-    newUniverse->entropyLevel = 0.618;  // Current entropy (Golden ratio)
-    newUniverse->maxEntropy = 1.0;      // Maximum entropy at heat death
-    
-    return newUniverse;
+    u->totalLifespanDays = 5000 * 365;  // Example: 5000 years in days
+    u->entropyLevel = 0.618;  // Current entropy (Golden ratio)
+    u->maxEntropy = 1.0;      // Maximum entropy at heat death
 }
 
 /**
- * Creates physical constants for the universe
+ * Allocate a shareable payload array of `size` bytes, owned by one universe
  */
-double* divinePhysicalConstants(int numConstants) {
-    if (numConstants <= 0) return NULL;
-    
-    double* constants = (double*)malloc(sizeof(double) * numConstants);
-    if (!constants) return NULL;
-    
-    // Set some known physical constants (simplified)
-    constants[0] = 299792458.0;      // Speed of light (m/s)
-    
-    // Protect against potential array access out of bounds
-    if (numConstants > 1) constants[1] = 6.62607015e-34;   // Planck's constant (J⋅s)
-    if (numConstants > 2) constants[2] = 6.67430e-11;      // Gravitational constant (m³/kg⋅s²)
-    if (numConstants > 3) constants[3] = 8.8541878128e-12; // Vacuum permittivity (F/m)
+static void* allocatePayload(size_t size) {
+    PayloadHeader* header = (PayloadHeader*)malloc(sizeof(PayloadHeader) + size);
+    if (!header) return NULL;
     
-    // Fill the rest with placeholder values
-    for (int i = 4; i < numConstants; i++) {
-        constants[i] = 1.0 / (i + 1); // Arbitrary values
-    }
+    header->refCount = 1;
+    header->arena = NULL;
     
-    return constants;
+    return header + 1;
 }
 
 /**
- * Free memory allocated for a revelation
+ * Header of a payload array
  */
-void freeRevelation(void* revelation) {
-    free(revelation);
+static PayloadHeader* payloadHeader(const void* payload) {
+    return (PayloadHeader*)payload - 1;
 }
 
 /**
- * Free memory allocated for a multiverse projection
+ * Take one more reference to a payload array
  */
-void freeProjection(void* projection) {
-    free(projection);
+static void retainPayload(void* payload) {
+    PayloadHeader* header = payloadHeader(payload);
+    if (__atomic_load_n(&header->refCount, __ATOMIC_RELAXED) != PAYLOAD_IMMORTAL) {
+        __atomic_fetch_add(&header->refCount, 1, __ATOMIC_RELAXED);
+    }
 }
 
 /**
- * Creation of conscious entity within universe
+ * Release the arena block of an arena universe once nothing lives in it any more
  */
-ConsciousEntity* createConsciousEntity(God* creator, Universe* universe, char* name) {
-    if (!creator || !universe || !name) return NULL;
-    
-    // Validate name length
-    if (strlen(name) >= MAX_NAME_LENGTH) return NULL;
-    
-    ConsciousEntity* entity = (ConsciousEntity*)malloc(sizeof(ConsciousEntity));
-    if (!entity) return NULL;
-    
-    // Initialize with NULL to handle cleanup on error
-    entity->consciousness = NULL;
-    entity->freeWill = NULL;
-    entity->name = NULL;
-    
-    entity->consciousness = malloc(sizeof(double));
-    if (!entity->consciousness) {
-        free(entity);
-        return NULL;
+static void releaseArena(UniverseArena* arena) {
+    if (__atomic_sub_fetch(&arena->refCount, 1, __ATOMIC_ACQ_REL) == 0) {
+        free(arena);
     }
-    *(double*)(entity->consciousness) = 1.0; // Consciousness level
+}
+
+/**
+ * Drop one reference to a payload array, freeing it with its last reference
+ */
+static void releasePayload(void* payload) {
+    if (!payload) return;
     
-    entity->freeWill = malloc(sizeof(double));
-    if (!entity->freeWill) {
-        free(entity->consciousness);
-        free(entity);
-        return NULL;
-    }
-    *(double*)(entity->freeWill) = 1.0; // Free will capacity
+    PayloadHeader* header = payloadHeader(payload);
+    if (__atomic_load_n(&header->refCount, __ATOMIC_RELAXED) == PAYLOAD_IMMORTAL) return;
     
-    entity->name = strdup(name); // Make a copy of the name
-    if (!entity->name) {
-        free(entity->freeWill);
-        free(entity->consciousness);
-        free(entity);
-        return NULL;
+    if (__atomic_sub_fetch(&header->refCount, 1, __ATOMIC_ACQ_REL) == 0) {
+        if (header->arena) {
+            releaseArena(header->arena);
+        } else {
+            free(header);
+        }
     }
+}
+
+/**
+ * Make a payload array exclusive to its universe before a write
+ * Returns the array itself when unshared, otherwise a private copy that
+ * replaces the caller's reference; NULL if out of memory
+ */
+static void* writablePayload(void* payload, size_t size) {
+    // Sole owner writes in place
+    if (__atomic_load_n(&payloadHeader(payload)->refCount, __ATOMIC_ACQUIRE) == 1) return payload;
     
-    entity->uniqueId = universe->numEntities + 1; // Assign unique ID
-    
-    // Assign function pointers
-    entity->formPrayer = (char* (*)(struct ConsciousEntity*))formPrayer;
-    entity->makeChoice = &entityMakeChoice;
-    
-    // Add entity to universe - FIXED: proper error handling
-    ConsciousEntity** newEntities = (ConsciousEntity**)realloc(
-        universe->consciousEntities, 
-        (universe->numEntities + 1) * sizeof(ConsciousEntity*)
-    );
-    
-    if (!newEntities) {
-        free(entity->name);
-        free(entity->freeWill);
-        free(entity->consciousness);
-        free(entity);
-        return NULL;
-    }
+    void* copy = allocatePayload(size);
+    if (!copy) return NULL;
+    memcpy(copy, payload, size);
     
-    universe->consciousEntities = newEntities;
-    universe->consciousEntities[universe->numEntities] = entity;
-    universe->numEntities++;
+    releasePayload(payload);
     
-    return entity;
+    return copy;
 }
 
 /**
- * Form a prayer - implementation for conscious entities
+ * Start a universe with an empty entity population
+ */
+static void initializeEntityStorage(Universe* u) {
+    u->consciousEntities = NULL;
+    u->numEntities = 0;
+    u->entityCapacity = 0;
+    u->entityTable.consciousness = NULL;
+    u->entityTable.freeWill = NULL;
+    u->entityTable.uniqueId = NULL;
+    u->entityTable.nameOffset = NULL;
+    u->entitySlabs = NULL;
+    u->namePool = NULL;
+    u->namePoolUsed = 0;
+    u->namePoolCapacity = 0;
+    u->nameIndex = NULL;
+    u->nameIndexMask = 0;
+    u->snapshotMapping = NULL;
+    u->snapshotMappingSize = 0;
+}
+
+/**
+ * Creation function - metaphorical representation of God creating a universe
+ */
+Universe* divineCreateUniverse() {
+    // Create a new universe with physical laws
+    Universe* newUniverse = (Universe*)malloc(sizeof(Universe));
+    if (!newUniverse) return NULL;
+    
+    // Initialize with NULL values first in case we need to free on error
+    newUniverse->physicalConstants = NULL;
+    newUniverse->spacetime = NULL;
+    newUniverse->matter = NULL;
+    newUniverse->energy = NULL;
+    initializeEntityStorage(newUniverse);
+    newUniverse->layout = UNIVERSE_LAYOUT_SEPARATE;
+    
+    // Physical constants are set according to divine wisdom - the shared
+    // default table, so there is nothing to allocate for them
+    
+    // Instantiate spacetime with placeholder data
+    newUniverse->spacetime = allocatePayload(sizeof(double) * SPACETIME_DIMENSIONS);
+    if (!newUniverse->spacetime) {
+        free(newUniverse);
+        return NULL;
+    }
+    
+    newUniverse->matter = allocatePayload(sizeof(double));
+    if (!newUniverse->matter) {
+        releasePayload(newUniverse->spacetime);
+        free(newUniverse);
+        return NULL;
+    }
+    
+    newUniverse->energy = allocatePayload(sizeof(double));
+    if (!newUniverse->energy) {
+        releasePayload(newUniverse->matter);
+        releasePayload(newUniverse->spacetime);
+        free(newUniverse);
+        return NULL;
+    }
+    
+    initializeUniverseState(newUniverse);
+    
+    return newUniverse;
+}
+
+/**
+ * Carve a payload array of `size` bytes out of an arena block at `cursor`
+ */
+static void* carveArenaPayload(UniverseArena* arena, char** cursor, size_t size) {
+    PayloadHeader* header = (PayloadHeader*)*cursor;
+    header->refCount = 1;
+    header->arena = arena;
+    *cursor += sizeof(PayloadHeader) + size;
+    
+    return header + 1;
+}
+
+/**
+ * Arena block that an arena universe lives in
+ */
+static UniverseArena* universeArena(const Universe* u) {
+    return (UniverseArena*)u - 1;
+}
+
+/**
+ * Allocate an arena universe - one block holding the struct and its payload:
+ * [arena header][Universe][spacetime][matter][energy]
+ * The constants start out in the shared default table, so they need no room.
+ * Only the payload pointers and entity bookkeeping are initialized
+ */
+static Universe* allocateUniverseArena(void) {
+    size_t spacetimeSize = sizeof(double) * SPACETIME_DIMENSIONS;
+    size_t blockSize = sizeof(UniverseArena) + sizeof(Universe) +
+                       3 * sizeof(PayloadHeader) + spacetimeSize + 2 * sizeof(double);
+    
+    UniverseArena* arena = (UniverseArena*)malloc(blockSize);
+    if (!arena) return NULL;
+    
+    // The resident struct and each of the three payload arrays hold a reference
+    arena->refCount = 4;
+    
+    // Every piece is a multiple of 8 bytes, so doubles stay aligned throughout
+    Universe* u = (Universe*)(arena + 1);
+    char* cursor = (char*)(u + 1);
+    u->physicalConstants = NULL;
+    u->spacetime = carveArenaPayload(arena, &cursor, spacetimeSize);
+    u->matter = carveArenaPayload(arena, &cursor, sizeof(double));
+    u->energy = carveArenaPayload(arena, &cursor, sizeof(double));
+    initializeEntityStorage(u);
+    u->layout = UNIVERSE_LAYOUT_ARENA;
+    
+    return u;
+}
+
+/**
+ * Creation function - arena mode
+ * Same universe as divineCreateUniverse, but made with a single allocation
+ * that freeUniverse releases with a single free
+ */
+Universe* divineCreateUniverseArena() {
+    Universe* newUniverse = allocateUniverseArena();
+    if (!newUniverse) return NULL;
+    
+    initializeUniverseState(newUniverse);
+    
+    return newUniverse;
+}
+
+/**
+ * Fork a universe - copy-on-write
+ * The fork shares the physical constants, spacetime, matter and energy of
+ * its origin by reference count, so forking costs the same for any number
+ * of constants. Conscious entities stay with the origin.
+ */
+Universe* forkUniverse(const Universe* u) {
+    if (!u) return NULL;
+    
+    Universe* fork = (Universe*)malloc(sizeof(Universe));
+    if (!fork) return NULL;
+    
+    *fork = *u;
+    initializeEntityStorage(fork);
+    fork->layout = UNIVERSE_LAYOUT_SEPARATE;
+    
+    retainPayload(fork->physicalConstants);
+    retainPayload(fork->spacetime);
+    retainPayload(fork->matter);
+    retainPayload(fork->energy);
+    
+    return fork;
+}
+
+/**
+ * Writable access to the physical constants of a universe
+ * Copies them first if they are shared with a fork; NULL if out of memory.
+ * Counts as a mutation: terms derived from the constants are recomputed on
+ * every countdown until universeSetConstant or universeResizeConstants next
+ * refreshes them. Ask again for later writes.
+ */
+double* universeWritableConstants(Universe* u) {
+    if (!u) return NULL;
+    
+    double* constants = (double*)writablePayload(u->physicalConstants, sizeof(double) * u->numConstants);
+    if (constants) {
+        u->physicalConstants = constants;
+        u->constantsVersion++;
+    }
+    
+    return constants;
+}
+
+/**
+ * Set one physical constant of a universe
+ * Returns false for an index out of range or if out of memory
+ */
+bool universeSetConstant(Universe* u, int index, double value) {
+    if (!u || index < 0 || index >= u->numConstants) return false;
+    
+    double* constants = universeWritableConstants(u);
+    if (!constants) return false;
+    
+    constants[index] = value;
+    refreshPhysicalInfluence(u);
+    return true;
+}
+
+/**
+ * Give a universe `numConstants` physical constants - existing values are
+ * kept, new ones are chosen like those of a new universe
+ * Returns false for a count below one or if out of memory
+ */
+bool universeResizeConstants(Universe* u, int numConstants) {
+    if (!u || numConstants <= 0) return false;
+    if (numConstants == u->numConstants) return true;
+    
+    double* constants = (double*)allocatePayload(sizeof(double) * numConstants);
+    if (!constants) return false;
+    
+    fillPhysicalConstants(constants, numConstants);
+    int kept = numConstants < u->numConstants ? numConstants : u->numConstants;
+    memcpy(constants, u->physicalConstants, sizeof(double) * kept);
+    
+    releasePayload(u->physicalConstants);
+    u->physicalConstants = constants;
+    u->numConstants = numConstants;
+    u->constantsVersion++;
+    refreshPhysicalInfluence(u);
+    
+    return true;
+}
+
+/**
+ * Writable access to the spacetime coordinates of a universe
+ */
+double* universeWritableSpacetime(Universe* u) {
+    if (!u) return NULL;
+    
+    double* spacetime = (double*)writablePayload(u->spacetime, sizeof(double) * SPACETIME_DIMENSIONS);
+    if (spacetime) u->spacetime = spacetime;
+    
+    return spacetime;
+}
+
+/**
+ * Writable access to the matter content of a universe
+ */
+double* universeWritableMatter(Universe* u) {
+    if (!u) return NULL;
+    
+    double* matter = (double*)writablePayload(u->matter, sizeof(double));
+    if (matter) u->matter = matter;
+    
+    return matter;
+}
+
+/**
+ * Writable access to the energy content of a universe
+ */
+double* universeWritableEnergy(Universe* u) {
+    if (!u) return NULL;
+    
+    double* energy = (double*)writablePayload(u->energy, sizeof(double));
+    if (energy) u->energy = energy;
+    
+    return energy;
+}
+
+/**
+ * Creates physical constants for the universe
+ */
+double* divinePhysicalConstants(int numConstants) {
+    if (numConstants <= 0) return NULL;
+    
+    double* constants = (double*)malloc(sizeof(double) * numConstants);
+    if (!constants) return NULL;
+    
+    fillPhysicalConstants(constants, numConstants);
+    
+    return constants;
+}
+
+/**
+ * Free memory allocated for a revelation
+ */
+void freeRevelation(void* revelation) {
+    free(revelation);
+}
+
+/**
+ * Free memory allocated for a multiverse projection
+ */
+void freeProjection(void* projection) {
+    free(projection);
+}
+
+/**
+ * Point every entity record back at its row of the entity table and its name
+ * Needed whenever a column or the name pool has moved
+ */
+static void repointEntityViews(Universe* universe) {
+    EntityTable* table = &universe->entityTable;
+    for (int i = 0; i < universe->numEntities; i++) {
+        ConsciousEntity* e = universe->consciousEntities[i];
+        e->consciousness = &table->consciousness[i];
+        e->freeWill = &table->freeWill[i];
+        e->name = universe->namePool + table->nameOffset[i];
+    }
+}
+
+/**
+ * Move the table columns, name pool and name index of a universe loaded
+ * from a snapshot out of the file mapping into memory of their own, so
+ * they can grow
+ */
+static bool detachEntitySnapshot(Universe* universe) {
+    EntityTable* table = &universe->entityTable;
+    size_t rows = (size_t)universe->numEntities;
+    size_t slots = universe->nameIndexMask + 1;
+    double* consciousness = (double*)malloc(sizeof(double) * rows);
+    double* freeWill = (double*)malloc(sizeof(double) * rows);
+    int* uniqueId = (int*)malloc(sizeof(int) * rows);
+    size_t* nameOffset = (size_t*)malloc(sizeof(size_t) * rows);
+    char* namePool = (char*)malloc(universe->namePoolUsed);
+    uint64_t* nameIndex = (uint64_t*)malloc(sizeof(uint64_t) * slots);
+    if (!consciousness || !freeWill || !uniqueId || !nameOffset || !namePool || !nameIndex) {
+        free(consciousness);
+        free(freeWill);
+        free(uniqueId);
+        free(nameOffset);
+        free(namePool);
+        free(nameIndex);
+        return false;
+    }
+    
+    memcpy(consciousness, table->consciousness, sizeof(double) * rows);
+    memcpy(freeWill, table->freeWill, sizeof(double) * rows);
+    memcpy(uniqueId, table->uniqueId, sizeof(int) * rows);
+    memcpy(nameOffset, table->nameOffset, sizeof(size_t) * rows);
+    memcpy(namePool, universe->namePool, universe->namePoolUsed);
+    memcpy(nameIndex, universe->nameIndex, sizeof(uint64_t) * slots);
+    
+    munmap(universe->snapshotMapping, universe->snapshotMappingSize);
+    universe->snapshotMapping = NULL;
+    universe->snapshotMappingSize = 0;
+    
+    table->consciousness = consciousness;
+    table->freeWill = freeWill;
+    table->uniqueId = uniqueId;
+    table->nameOffset = nameOffset;
+    universe->namePool = namePool;
+    universe->namePoolCapacity = universe->namePoolUsed;
+    universe->nameIndex = nameIndex;
+    repointEntityViews(universe);
+    
+    return true;
+}
+
+/**
+ * Reallocate one registry or table column to `capacity` rows
+ * Once a resize has failed the remaining columns are left alone
+ */
+static void* resizeEntityColumn(void* column, int capacity, size_t rowSize, bool* resized) {
+    if (!*resized) return column;
+    
+    void* grown = realloc(column, (size_t)capacity * rowSize);
+    if (!grown) {
+        *resized = false;
+        return column;
+    }
+    
+    return grown;
+}
+
+/**
+ * Hash of `length` bytes for the name and knowledge indexes - 64-bit FNV-1a
+ * folded to 32 bits
+ */
+static uint32_t hashBytes(const char* data, size_t length) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)data[i]) * 1099511628211ull;
+    }
+    
+    return (uint32_t)(hash ^ (hash >> 32));
+}
+
+static uint32_t hashString(const char* string) {
+    return hashBytes(string, strlen(string));
+}
+
+/**
+ * Row of the entity named `name`, whose hash is `tag`, or -1
+ */
+static int nameIndexFind(const Universe* u, const char* name, uint32_t tag) {
+    const uint64_t* index = u->nameIndex;
+    size_t mask = u->nameIndexMask;
+    for (size_t slot = tag & mask; index[slot] != 0; slot = (slot + 1) & mask) {
+        uint64_t entry = index[slot];
+        if ((uint32_t)(entry >> 32) != tag) continue;
+        
+        int row = (int)(uint32_t)entry - 1;
+        if (strcmp(u->namePool + u->entityTable.nameOffset[row], name) == 0) return row;
+    }
+    
+    return -1;
+}
+
+/**
+ * Add an entity's name to the name index - a name already there keeps its
+ * entity, so a lookup finds the first entity created under a name
+ */
+static void indexEntityNameHashed(Universe* u, int row, uint32_t tag) {
+    if (nameIndexFind(u, u->namePool + u->entityTable.nameOffset[row], tag) >= 0) return;
+    
+    size_t slot = tag & u->nameIndexMask;
+    while (u->nameIndex[slot] != 0) slot = (slot + 1) & u->nameIndexMask;
+    u->nameIndex[slot] = ((uint64_t)tag << 32) | (uint32_t)(row + 1);
+}
+
+static void indexEntityName(Universe* u, int row) {
+    indexEntityNameHashed(u, row, hashString(u->namePool + u->entityTable.nameOffset[row]));
+}
+
+/**
+ * Add the names of rows [begin, end) to the name index, in row order
+ * Hashes run NAME_LOOKUP_PREFETCH rows ahead of the inserts, with their
+ * slots prefetched, as in findConsciousEntities.
+ */
+static void indexEntityNames(Universe* u, int begin, int end) {
+    uint32_t tags[NAME_LOOKUP_PREFETCH];
+    for (int row = begin; row < end + NAME_LOOKUP_PREFETCH; row++) {
+        int insert = row - NAME_LOOKUP_PREFETCH;
+        if (insert >= begin) {
+            indexEntityNameHashed(u, insert, tags[insert % NAME_LOOKUP_PREFETCH]);
+        }
+        
+        if (row < end) {
+            uint32_t tag = hashString(u->namePool + u->entityTable.nameOffset[row]);
+            tags[row % NAME_LOOKUP_PREFETCH] = tag;
+            __builtin_prefetch(&u->nameIndex[tag & u->nameIndexMask], 1);
+        }
+    }
+}
+
+/**
+ * Slots of an open-addressing index holding `entries` at most 3/4 full
+ */
+static size_t hashIndexSlots(size_t entries) {
+    size_t needed = entries + entries / 3 + 1;
+    size_t slots = HASH_INDEX_MIN;
+    while (slots < needed) slots *= 2;
+    
+    return slots;
+}
+
+/**
+ * Copy of an open-addressing index of (hash << 32) | (id + 1) slots
+ * rehashed into `slots` slots, or NULL if out of memory
+ * Entries move by the hash they carry, without touching their keys.
+ */
+static uint64_t* rehashIndex(const uint64_t* index, size_t mask, size_t slots) {
+    uint64_t* rehashed = (uint64_t*)calloc(slots, sizeof(uint64_t));
+    if (!rehashed || !index) return rehashed;
+    
+    size_t rehashedMask = slots - 1;
+    for (size_t i = 0; i <= mask; i++) {
+        uint64_t entry = index[i];
+        if (entry == 0) continue;
+        
+        size_t slot = (size_t)(entry >> 32) & rehashedMask;
+        while (rehashed[slot] != 0) slot = (slot + 1) & rehashedMask;
+        rehashed[slot] = entry;
+    }
+    
+    return rehashed;
+}
+
+/**
+ * Grow an open-addressing index to hold `entries` at most 3/4 full - true
+ * if it already does
+ */
+static bool growHashIndex(uint64_t** index, size_t* mask, size_t entries) {
+    size_t slots = hashIndexSlots(entries);
+    if (*index && slots <= *mask + 1) return true;
+    
+    uint64_t* grown = rehashIndex(*index, *mask, slots);
+    if (!grown) return false;
+    
+    free(*index);
+    *index = grown;
+    *mask = slots - 1;
+    
+    return true;
+}
+
+/**
+ * Grow the name index to hold `rows` names
+ */
+static bool resizeNameIndex(Universe* universe, int rows) {
+    return growHashIndex(&universe->nameIndex, &universe->nameIndexMask, (size_t)rows);
+}
+
+/**
+ * Resize the registry and every column of the entity table to `capacity`
+ * rows, and the name index to match
+ */
+static bool resizeEntityStorage(Universe* universe, int capacity) {
+    if (universe->snapshotMapping && !detachEntitySnapshot(universe)) return false;
+    if (!resizeNameIndex(universe, capacity)) return false;
+    
+    EntityTable* table = &universe->entityTable;
+    bool resized = true;
+    universe->consciousEntities = (ConsciousEntity**)resizeEntityColumn(
+        universe->consciousEntities, capacity, sizeof(ConsciousEntity*), &resized);
+    table->consciousness = (double*)resizeEntityColumn(table->consciousness, capacity, sizeof(double), &resized);
+    table->freeWill = (double*)resizeEntityColumn(table->freeWill, capacity, sizeof(double), &resized);
+    table->uniqueId = (int*)resizeEntityColumn(table->uniqueId, capacity, sizeof(int), &resized);
+    table->nameOffset = (size_t*)resizeEntityColumn(table->nameOffset, capacity, sizeof(size_t), &resized);
+    
+    // Columns that did move need their views fixed even if a later one failed
+    repointEntityViews(universe);
+    
+    if (resized) {
+        universe->entityCapacity = capacity;
+    }
+    
+    return resized;
+}
+
+/**
+ * Add a slab with room for `capacity` entity records to a universe
+ */
+static EntitySlab* addEntitySlab(Universe* universe, int capacity) {
+    EntitySlab* slab = (EntitySlab*)malloc(sizeof(EntitySlab) + (size_t)capacity * sizeof(ConsciousEntity));
+    if (!slab) return NULL;
+    
+    slab->used = 0;
+    slab->capacity = capacity;
+    
+    // Any records left in the previous slab are abandoned
+    slab->next = universe->entitySlabs;
+    universe->entitySlabs = slab;
+    
+    return slab;
+}
+
+/**
+ * Reserve room in the entity registry of a universe for `n` entities in total
+ * Lets a population of known size be created without regrowing the registry
+ * or the entity table, and with its records in a single slab
+ */
+bool reserveEntities(Universe* universe, int n) {
+    if (!universe || n < 0) return false;
+    
+    if (n > universe->entityCapacity && !resizeEntityStorage(universe, n)) {
+        return false;
+    }
+    
+    EntitySlab* slab = universe->entitySlabs;
+    int freeRecords = slab ? slab->capacity - slab->used : 0;
+    if (n - universe->numEntities > freeRecords &&
+        !addEntitySlab(universe, n - universe->numEntities)) {
+        return false;
+    }
+    
+    return true;
+}
+
+/**
+ * Grow a full entity registry by doubling its capacity
+ * Keeps populating N entities at O(N) total copying
+ */
+static bool growEntityRegistry(Universe* universe) {
+    int newCapacity;
+    if (universe->entityCapacity >= INT_MAX / 2) {
+        if (universe->entityCapacity == INT_MAX) return false;
+        newCapacity = INT_MAX;
+    } else {
+        newCapacity = universe->entityCapacity > 0 ? universe->entityCapacity * 2 : 16;
+    }
+    
+    return resizeEntityStorage(universe, newCapacity);
+}
+
+/**
+ * Take the next free entity record, adding a slab as large as the current
+ * population when the newest one is full
+ */
+static ConsciousEntity* allocateEntityRecord(Universe* universe) {
+    EntitySlab* slab = universe->entitySlabs;
+    if (!slab || slab->used == slab->capacity) {
+        int capacity = universe->numEntities > ENTITY_SLAB_MIN ? universe->numEntities : ENTITY_SLAB_MIN;
+        slab = addEntitySlab(universe, capacity);
+        if (!slab) return NULL;
+    }
+    
+    return &slab->entities[slab->used++];
+}
+
+/**
+ * Make an entity record the view of row `row` of its universe's table
+ */
+static void bindEntityRecord(const Universe* universe, ConsciousEntity* entity, int row) {
+    const EntityTable* table = &universe->entityTable;
+    entity->consciousness = &table->consciousness[row];
+    entity->freeWill = &table->freeWill[row];
+    entity->name = universe->namePool + table->nameOffset[row];
+    entity->uniqueId = table->uniqueId[row];
+    
+    // Assign function pointers
+    entity->formPrayer = (char* (*)(struct ConsciousEntity*))formPrayer;
+    entity->makeChoice = &entityMakeChoice;
+}
+
+/**
+ * Make room for `bytes` more bytes in the name pool of a universe
+ * The pool grows by doubling; existing entity names move with it
+ */
+static bool reserveNamePool(Universe* universe, size_t bytes) {
+    if (universe->snapshotMapping && !detachEntitySnapshot(universe)) return false;
+    if (universe->namePoolCapacity - universe->namePoolUsed >= bytes) return true;
+    
+    size_t newCapacity = universe->namePoolCapacity > 0 ? universe->namePoolCapacity * 2 : NAME_POOL_MIN;
+    while (newCapacity - universe->namePoolUsed < bytes) {
+        newCapacity *= 2;
+    }
+    
+    char* newPool = (char*)realloc(universe->namePool, newCapacity);
+    if (!newPool) return false;
+    
+    universe->namePool = newPool;
+    universe->namePoolCapacity = newCapacity;
+    repointEntityViews(universe);
+    
+    return true;
+}
+
+/**
+ * Copy a name of `length` bytes into the string pool of a universe and
+ * return its offset there, or -1 if out of memory
+ */
+static long poolEntityName(Universe* universe, const char* name, size_t length) {
+    if (!reserveNamePool(universe, length + 1)) return -1;
+    
+    size_t offset = universe->namePoolUsed;
+    memcpy(universe->namePool + offset, name, length + 1);
+    universe->namePoolUsed += length + 1;
+    
+    return (long)offset;
+}
+
+/**
+ * Creation of conscious entity within universe
+ * The attributes go into a new row of the universe's entity table and the
+ * record, taken from the entity slabs, is a view over that row. Attribute
+ * and name pointers move when the table or name pool grows - always read
+ * them through the entity
+ */
+ConsciousEntity* createConsciousEntity(God* creator, Universe* universe, char* name) {
+    if (!creator || !universe || !name) return NULL;
+    
+    // Validate name length
+    size_t nameLength = strlen(name);
+    if (nameLength >= MAX_NAME_LENGTH) return NULL;
+    
+    // Make room in the registry first so a full registry needs no cleanup
+    if (universe->numEntities == universe->entityCapacity && !growEntityRegistry(universe)) {
+        return NULL;
+    }
+    
+    long nameOffset = poolEntityName(universe, name, nameLength);
+    if (nameOffset < 0) return NULL;
+    
+    ConsciousEntity* entity = allocateEntityRecord(universe);
+    if (!entity) {
+        universe->namePoolUsed -= nameLength + 1; // Give the name back to the pool
+        return NULL;
+    }
+    
+    // Fill the entity's row of the table; the record views it
+    int row = universe->numEntities;
+    EntityTable* table = &universe->entityTable;
+    table->consciousness[row] = 1.0; // Consciousness level
+    table->freeWill[row] = 1.0;      // Free will capacity
+    table->uniqueId[row] = row + 1;  // Assign unique ID
+    table->nameOffset[row] = (size_t)nameOffset;
+    
+    bindEntityRecord(universe, entity, row);
+    indexEntityName(universe, row);
+    
+    // Add entity to universe - room was made in the registry up front
+    universe->consciousEntities[universe->numEntities] = entity;
+    universe->numEntities++;
+    
+    return entity;
+}
+
+/**
+ * The entity of a universe with the given name, or NULL
+ * Looked up in the universe's name index; with several entities of one
+ * name, the first created is found.
+ */
+ConsciousEntity* findConsciousEntity(const Universe* u, const char* name) {
+    if (!u || !name || !u->nameIndex) return NULL;
+    
+    int row = nameIndexFind(u, name, hashString(name));
+    return row >= 0 ? u->consciousEntities[row] : NULL;
+}
+
+/**
+ * Look up `count` names at once - entities[i] receives the entity named
+ * names[i], or NULL
+ * Names are hashed NAME_LOOKUP_PREFETCH ahead of the probes and their index
+ * slots prefetched, so the cache misses of a large index overlap instead of
+ * being paid one after another. Returns the number of names found.
+ */
+int findConsciousEntities(const Universe* u, const char* const* names, int count, ConsciousEntity** entities) {
+    if (!u || !names || !entities || count < 0) return 0;
+    if (!u->nameIndex) {
+        for (int i = 0; i < count; i++) entities[i] = NULL;
+        return 0;
+    }
+    
+    uint32_t tags[NAME_LOOKUP_PREFETCH];
+    int found = 0;
+    for (int i = 0; i < count + NAME_LOOKUP_PREFETCH; i++) {
+        // Probe the name hashed NAME_LOOKUP_PREFETCH ago, then take its place in the ring
+        int probe = i - NAME_LOOKUP_PREFETCH;
+        if (probe >= 0) {
+            int row = names[probe] ? nameIndexFind(u, names[probe], tags[probe % NAME_LOOKUP_PREFETCH]) : -1;
+            entities[probe] = row >= 0 ? u->consciousEntities[row] : NULL;
+            found += row >= 0;
+        }
+        
+        if (i < count && names[i]) {
+            uint32_t tag = hashString(names[i]);
+            tags[i % NAME_LOOKUP_PREFETCH] = tag;
+            __builtin_prefetch(&u->nameIndex[tag & u->nameIndexMask]);
+        }
+    }
+    
+    return found;
+}
+
+/* Newline scan over a names file - count all newlines, find the next one */
+typedef struct NewlineScanner {
+    size_t (*count)(const char* data, size_t size);
+    const char* (*next)(const char* data, const char* end);
+} NewlineScanner;
+
+/**
+ * Count the newlines of a buffer
+ */
+static size_t countNewlinesScalar(const char* data, size_t size) {
+    size_t count = 0;
+    const char* end = data + size;
+    while ((data = (const char*)memchr(data, '\n', (size_t)(end - data))) != NULL) {
+        count++;
+        data++;
+    }
+    
+    return count;
+}
+
+/**
+ * First newline in [data, end), or end if there is none
+ */
+static const char* nextNewlineScalar(const char* data, const char* end) {
+    const char* newline = (const char*)memchr(data, '\n', (size_t)(end - data));
+    return newline ? newline : end;
+}
+
+#if GOD_X86_SIMD
+/**
+ * AVX2 newline count - compares 32 bytes at a time and counts the mask bits
+ */
+__attribute__((target("avx2,popcnt")))
+static size_t countNewlinesAvx2(const char* data, size_t size) {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)(data + i));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, newline));
+        count += (size_t)__builtin_popcount(mask);
+    }
+    
+    return count + countNewlinesScalar(data + i, size - i);
+}
+
+/**
+ * AVX2 search for the next newline, 32 bytes at a time
+ */
+__attribute__((target("avx2")))
+static const char* nextNewlineAvx2(const char* data, const char* end) {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    for (; end - data >= 32; data += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)data);
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, newline));
+        if (mask) return data + __builtin_ctz(mask);
+    }
+    
+    return nextNewlineScalar(data, end);
+}
+#endif /* GOD_X86_SIMD */
+
+/**
+ * Widest newline scanner this CPU runs
+ */
+static const NewlineScanner* selectNewlineScanner(void) {
+    static const NewlineScanner scalarScanner = { &countNewlinesScalar, &nextNewlineScalar };
+#if GOD_X86_SIMD
+    static const NewlineScanner avx2Scanner = { &countNewlinesAvx2, &nextNewlineAvx2 };
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) return &avx2Scanner;
+#endif
+    return &scalarScanner;
+}
+
+/**
+ * Append an entity named by the `length` bytes at `name` - room in the
+ * registry, the slabs and the name pool must already be reserved, and the
+ * name is left for the caller to index
+ */
+static void appendReservedEntity(Universe* universe, const char* name, size_t length) {
+    int row = universe->numEntities;
+    size_t nameOffset = universe->namePoolUsed;
+    memcpy(universe->namePool + nameOffset, name, length);
+    universe->namePool[nameOffset + length] = '\0';
+    universe->namePoolUsed += length + 1;
+    
+    EntityTable* table = &universe->entityTable;
+    table->consciousness[row] = 1.0;
+    table->freeWill[row] = 1.0;
+    table->uniqueId[row] = row + 1;
+    table->nameOffset[row] = nameOffset;
+    
+    ConsciousEntity* entity = allocateEntityRecord(universe);
+    bindEntityRecord(universe, entity, row);
+    universe->consciousEntities[row] = entity;
+    universe->numEntities++;
+}
+
+/**
+ * Bulk creation of conscious entities, one per line of a names file
+ * The file is mapped and scanned for newlines with SIMD where available.
+ * The registry, table, slabs and name pool are sized once for the whole
+ * file, then every name is copied straight into the pool with ids
+ * assigned in order. Empty lines are skipped, as are names that
+ * createConsciousEntity would refuse for their length; a trailing '\r'
+ * is dropped. Returns the number of entities created, or -1 if the file
+ * can not be read or the universe can not hold them all - in which case
+ * none are created.
+ */
+int createConsciousEntitiesFromFile(God* creator, Universe* universe, const char* path) {
+    if (!creator || !universe || !path) return -1;
+    
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        close(fd);
+        return -1;
+    }
+    size_t size = (size_t)status.st_size;
+    if (size == 0) {
+        close(fd);
+        return 0;
+    }
+    
+    const char* data = (const char*)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file alive
+    if (data == MAP_FAILED) return -1;
+    posix_madvise((void*)data, size, POSIX_MADV_SEQUENTIAL);
+    
+    // Every line may become an entity, and the names take at most the
+    // file's bytes with each newline turned into a NUL
+    const NewlineScanner* scanner = selectNewlineScanner();
+    size_t lines = scanner->count(data, size) + (data[size - 1] != '\n');
+    if (lines > (size_t)(INT_MAX - universe->numEntities) ||
+        !reserveEntities(universe, universe->numEntities + (int)lines) ||
+        !reserveNamePool(universe, size + 1)) {
+        munmap((void*)data, size);
+        return -1;
+    }
+    
+    int created = 0;
+    int firstRow = universe->numEntities;
+    const char* end = data + size;
+    for (const char* line = data; line < end; ) {
+        const char* newline = scanner->next(line, end);
+        size_t length = (size_t)(newline - line);
+        if (length > 0 && line[length - 1] == '\r') length--;
+        
+        if (length > 0 && length < MAX_NAME_LENGTH) {
+            appendReservedEntity(universe, line, length);
+            created++;
+        }
+        line = newline + 1;
+    }
+    indexEntityNames(universe, firstRow, universe->numEntities);
+    
+    munmap((void*)data, size);
+    return created;
+}
+
+/**
+ * Sum a contiguous column of `count` values
+ * Four independent accumulators let the compiler vectorize the scan
+ */
+static double sumEntityColumn(const double* column, int count) {
+    double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        sum0 += column[i];
+        sum1 += column[i + 1];
+        sum2 += column[i + 2];
+        sum3 += column[i + 3];
+    }
+    for (; i < count; i++) {
+        sum0 += column[i];
+    }
+    
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
+/**
+ * Total consciousness of the population of a universe
+ * Scans the consciousness column of the entity table, not the records
+ */
+double universeTotalConsciousness(const Universe* u) {
+    if (!u || u->numEntities == 0) return 0.0;
+    
+    return sumEntityColumn(u->entityTable.consciousness, u->numEntities);
+}
+
+/**
+ * Number of entities in a universe with free will capacity of at least `threshold`
+ */
+int universeCountFreeWill(const Universe* u, double threshold) {
+    if (!u) return 0;
+    
+    const double* freeWill = u->entityTable.freeWill;
+    int count = 0;
+    for (int i = 0; i < u->numEntities; i++) {
+        count += freeWill[i] >= threshold; // Branch-free so the loop vectorizes
+    }
+    
+    return count;
+}
+
+/**
+ * Form a prayer - implementation for conscious entities
  * FIXED: prevent buffer overflow and ensure proper memory management
  */
-char* formPrayer(ConsciousEntity* entity) {
-    if (!entity) return NULL;
+char* formPrayer(ConsciousEntity* entity) {
+    if (!entity) return NULL;
+    
+    // Create a prayer based on entity's name with proper buffer length check
+    char* prayer = (char*)malloc(MAX_PRAYER_LENGTH);
+    if (!prayer) return NULL;
+    
+    // Use snprintf to prevent buffer overflow
+    int result = snprintf(prayer, MAX_PRAYER_LENGTH, 
+                         PRAYER_PREFIX "%s" PRAYER_SUFFIX, entity->name);
+    
+    // Check if snprintf was successful
+    if (result < 0 || result >= MAX_PRAYER_LENGTH) {
+        free(prayer);
+        return NULL;
+    }
+    
+    return prayer;
+}
+
+/* Text of each prayer template around the entity's name */
+static const struct {
+    const char* prefix;
+    const char* suffix;
+} prayerTemplates[PRAYER_TEMPLATE_COUNT] = {
+    { PRAYER_PREFIX, PRAYER_SUFFIX } // PRAYER_TEMPLATE_GUIDANCE
+};
+
+/**
+ * Form an entity's prayer as a template prayer - no formatting, no allocation
+ * Returns false for a NULL entity.
+ */
+bool formTemplatePrayer(const ConsciousEntity* entity, TemplatePrayer* prayer) {
+    if (!entity || !prayer) return false;
+    
+    prayer->templateId = PRAYER_TEMPLATE_GUIDANCE;
+    prayer->entityId = entity->uniqueId;
+    return true;
+}
+
+/**
+ * Row of the entity with the given uniqueId in a universe, or -1
+ */
+static int entityRowOf(const Universe* u, int entityId) {
+    int row = entityId - 1; // uniqueId is row + 1
+    if (row < 0 || row >= u->numEntities || u->entityTable.uniqueId[row] != entityId) return -1;
+    return row;
+}
+
+/**
+ * Render a template prayer to text for an entity of universe u, snprintf-style:
+ * writes at most size bytes, NUL included, into buffer and returns the
+ * length of the whole text - a return of size or more means it was cut short.
+ * Returns 0 for an unknown template or entity.
+ */
+size_t renderTemplatePrayer(const TemplatePrayer* prayer, const Universe* u, char* buffer, size_t size) {
+    if (!prayer || !u || prayer->templateId < 0 || prayer->templateId >= PRAYER_TEMPLATE_COUNT) return 0;
+    
+    int row = entityRowOf(u, prayer->entityId);
+    if (row < 0) return 0;
+    
+    const char* pieces[3] = {
+        prayerTemplates[prayer->templateId].prefix,
+        u->namePool + u->entityTable.nameOffset[row],
+        prayerTemplates[prayer->templateId].suffix
+    };
+    size_t length = 0;
+    for (int i = 0; i < 3; i++) {
+        size_t pieceLength = strlen(pieces[i]);
+        if (buffer && length < size) {
+            size_t room = size - length - 1;
+            memcpy(buffer + length, pieces[i], pieceLength < room ? pieceLength : room);
+        }
+        length += pieceLength;
+    }
+    if (buffer && size > 0) buffer[length < size ? length : size - 1] = '\0';
+    
+    return length;
+}
+
+/**
+ * Form the prayers of entities [first, first + count) of a universe in one go
+ * The prayers are written NUL-terminated and back to back into the caller's
+ * arena, prayer i starting at arena + offsets[i], with no heap allocation.
+ * Returns the number of arena bytes the batch needs; nothing is written
+ * unless that fits in arenaSize, so a call with a NULL arena sizes it.
+ * Returns 0 for an invalid entity range.
+ */
+size_t formPrayerBatch(const Universe* u, int first, int count,
+                       char* arena, size_t arenaSize, size_t* offsets) {
+    if (!u || first < 0 || count < 0 || count > u->numEntities - first) return 0;
+    
+    const size_t prefixLength = sizeof(PRAYER_PREFIX) - 1;
+    const size_t suffixLength = sizeof(PRAYER_SUFFIX) - 1;
+    const size_t* nameOffset = u->entityTable.nameOffset;
+    
+    // Size the whole batch first
+    size_t needed = 0;
+    for (int i = first; i < first + count; i++) {
+        needed += prefixLength + strlen(u->namePool + nameOffset[i]) + suffixLength + 1;
+    }
+    if (!arena || !offsets || needed > arenaSize) return needed;
+    
+    // Assemble every prayer from its pieces - no formatting needed
+    char* cursor = arena;
+    for (int i = 0; i < count; i++) {
+        const char* name = u->namePool + nameOffset[first + i];
+        size_t nameLength = strlen(name);
+        
+        offsets[i] = (size_t)(cursor - arena);
+        memcpy(cursor, PRAYER_PREFIX, prefixLength);
+        cursor += prefixLength;
+        memcpy(cursor, name, nameLength);
+        cursor += nameLength;
+        memcpy(cursor, PRAYER_SUFFIX, suffixLength + 1); // Suffix and its NUL
+        cursor += suffixLength + 1;
+    }
+    
+    return needed;
+}
+
+/**
+ * Always returns true - used for divine necessary existence
+ */
+bool alwaysTrue() {
+    return true;
+}
+
+/**
+ * Trinity equality function - paradoxical equality
+ */
+bool trinityEquality(const void* p1, const void* p2) {
+    // In trinitarian concept, persons are distinct yet one
+    // This is a simplified representation of that paradox
+    return true; // All persons are equal in essence
+}
+
+/**
+ * Divine projection into space - omnipresence
+ */
+void divineProjectIntoSpace(const void* space) {
+    // Symbolic implementation of omnipresence
+    // No actual operation needed in this simulation
+    (void)space; // Suppress unused parameter warning
+}
+
+/**
+ * Divine projection into time - atemporality
+ */
+void divineProjectIntoTime(const TimePoint* t) {
+    // Symbolic implementation of atemporality
+    // No actual operation needed in this simulation
+    (void)t; // Suppress unused parameter warning
+}
+
+/**
+ * Divine justice evaluation
+ */
+double divineJusticeEvaluation(void* moralFramework) {
+    // Perfect justice
+    (void)moralFramework; // Suppress unused parameter warning
+    return INFINITY_REPRESENTATION;
+}
+
+/**
+ * Divine compatibility with free will
+ */
+bool divineFreeWillCompatibility(const ConsciousEntity* e, void* choice) {
+    // God's omnipotence is compatible with genuine free will
+    (void)e;      // Suppress unused parameter warning
+    (void)choice; // Suppress unused parameter warning
+    return true;
+}
+
+/**
+ * Divine miracle - intervention in natural laws
+ */
+Universe* divineMiracle(const Universe* u, const TimePoint* t) {
+    if (!u) return NULL;
+    (void)t; // Suppress unused parameter warning
+    
+    // The miracle only touches scalar state, so the payload can be shared
+    Universe* newUniverse = forkUniverse(u);
+    if (!newUniverse) return NULL;
+    
+    // Make a "miraculous" change - reduce entropy as an intervention
+    newUniverse->entropyLevel *= 0.9; // Reduce entropy by 10%
+    
+    return newUniverse;
+}
+
+/* Prayer intents compiled into an Aho-Corasick automaton - a DFA over byte
+ * classes with the failure links folded into the transitions, so matching
+ * makes one table step per prayer byte however many intents there are */
+struct PrayerIntents {
+    int numIntents;
+    int numClasses;             // Byte classes - one per byte used by a phrase, 0 for the rest
+    int numStates;              // State 0 is the root
+    unsigned char byteClass[256];
+    int* transitions;           // numStates * numClasses next states
+    uint64_t* matches;          // Intents whose phrase ends in each state
+    long* lifespanDays;         // Adjustments of each intent
+    double* entropyFactor;
+    
+    /* First bytes of the phrases - while at the root, bytes that start no
+     * phrase are skipped without walking the automaton */
+    bool firstByte[256];
+    unsigned char firstBytes[PRAYER_INTENT_PREFILTER];
+    int numFirstBytes;          // Distinct first bytes, above PRAYER_INTENT_PREFILTER only counted
+    size_t (*skip)(const PrayerIntents* intents, const unsigned char* text, size_t position, size_t length);
+    
+    /* Each prayer template's prefix, matched once: the automaton state
+     * after it and the intents it asks for - name and suffix go on from there */
+    int templateState[PRAYER_TEMPLATE_COUNT];
+    uint64_t templateMatches[PRAYER_TEMPLATE_COUNT];
+};
+
+/**
+ * Position of the next byte from `position` that starts a phrase, or `length`
+ */
+static size_t skipToFirstByte(const PrayerIntents* intents, const unsigned char* text,
+                              size_t position, size_t length) {
+    while (position < length && !intents->firstByte[text[position]]) position++;
+    return position;
+}
+
+#if GOD_X86_SIMD
+/**
+ * AVX2 skipToFirstByte - compares 32 bytes at a time against every first byte
+ */
+__attribute__((target("avx2,bmi")))
+static size_t skipToFirstByteAvx2(const PrayerIntents* intents, const unsigned char* text,
+                                  size_t position, size_t length) {
+    __m256i firstBytes[PRAYER_INTENT_PREFILTER];
+    for (int i = 0; i < intents->numFirstBytes; i++) {
+        firstBytes[i] = _mm256_set1_epi8((char)intents->firstBytes[i]);
+    }
+    
+    for (; position + 32 <= length; position += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(text + position));
+        __m256i hits = _mm256_cmpeq_epi8(block, firstBytes[0]);
+        for (int i = 1; i < intents->numFirstBytes; i++) {
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, firstBytes[i]));
+        }
+        unsigned mask = (unsigned)_mm256_movemask_epi8(hits);
+        if (mask) return position + (size_t)_tzcnt_u32(mask);
+    }
+    
+    return skipToFirstByte(intents, text, position, length);
+}
+#endif /* GOD_X86_SIMD */
+
+/**
+ * Step the automaton through `length` bytes of text from *state, adding
+ * the intents whose phrases end on the way to `matched`
+ * Stops early once every intent is matched; *state is then meaningless.
+ */
+static uint64_t matchIntentsFrom(const PrayerIntents* intents, const unsigned char* text, size_t length,
+                                 int* state, uint64_t matched) {
+    uint64_t all = intents->numIntents == MAX_PRAYER_INTENTS ? ~(uint64_t)0
+                                                             : ((uint64_t)1 << intents->numIntents) - 1;
+    int current = *state;
+    
+    size_t i = 0;
+    while (i < length && matched != all) {
+        if (current == 0) {
+            i = intents->skip(intents, text, i, length);
+            if (i == length) break;
+        }
+        current = intents->transitions[current * intents->numClasses + intents->byteClass[text[i++]]];
+        matched |= intents->matches[current];
+    }
+    
+    *state = current;
+    return matched;
+}
+
+/**
+ * Compile a table of intents into one automaton
+ * Returns NULL for more than MAX_PRAYER_INTENTS intents, a missing or
+ * empty phrase, or if out of memory. The phrases need not outlive it.
+ */
+PrayerIntents* createPrayerIntents(const PrayerIntent* intents, int count) {
+    if (!intents || count <= 0 || count > MAX_PRAYER_INTENTS) return NULL;
+    
+    size_t maxStates = 1;
+    for (int i = 0; i < count; i++) {
+        if (!intents[i].phrase || !intents[i].phrase[0]) return NULL;
+        maxStates += strlen(intents[i].phrase);
+    }
+    if (maxStates > INT_MAX) return NULL;
+    
+    PrayerIntents* table = (PrayerIntents*)calloc(1, sizeof(PrayerIntents));
+    if (!table) return NULL;
+    
+    // One class per byte some phrase uses; all other bytes share class 0
+    int numClasses = 1;
+    for (int i = 0; i < count; i++) {
+        for (const unsigned char* c = (const unsigned char*)intents[i].phrase; *c; c++) {
+            if (!table->byteClass[*c]) table->byteClass[*c] = (unsigned char)numClasses++;
+        }
+    }
+    table->numIntents = count;
+    table->numClasses = numClasses;
+    
+    table->transitions = (int*)malloc(sizeof(int) * maxStates * (size_t)numClasses);
+    table->matches = (uint64_t*)calloc(maxStates, sizeof(uint64_t));
+    table->lifespanDays = (long*)malloc(sizeof(long) * (size_t)count);
+    table->entropyFactor = (double*)malloc(sizeof(double) * (size_t)count);
+    int* failure = (int*)malloc(sizeof(int) * maxStates);
+    int* queue = (int*)malloc(sizeof(int) * maxStates);
+    if (!table->transitions || !table->matches || !table->lifespanDays ||
+        !table->entropyFactor || !failure || !queue) {
+        free(failure);
+        free(queue);
+        freePrayerIntents(table);
+        return NULL;
+    }
+    
+    // Trie of the phrases, -1 where there is no edge yet
+    for (size_t i = 0; i < maxStates * (size_t)numClasses; i++) table->transitions[i] = -1;
+    int numStates = 1;
+    for (int i = 0; i < count; i++) {
+        int state = 0;
+        for (const unsigned char* c = (const unsigned char*)intents[i].phrase; *c; c++) {
+            int* next = &table->transitions[state * numClasses + table->byteClass[*c]];
+            if (*next < 0) *next = numStates++;
+            state = *next;
+        }
+        table->matches[state] |= (uint64_t)1 << i;
+        table->lifespanDays[i] = intents[i].lifespanDays;
+        table->entropyFactor[i] = intents[i].entropyFactor;
+        
+        unsigned char first = (unsigned char)intents[i].phrase[0];
+        if (!table->firstByte[first]) {
+            table->firstByte[first] = true;
+            if (table->numFirstBytes < PRAYER_INTENT_PREFILTER) table->firstBytes[table->numFirstBytes] = first;
+            table->numFirstBytes++;
+        }
+    }
+    table->numStates = numStates;
+    
+    // Breadth first, fold each state's failure link into its missing
+    // transitions and its matches, so no failure link is followed at match time
+    int head = 0;
+    int tail = 0;
+    for (int k = 0; k < numClasses; k++) {
+        int* next = &table->transitions[k];
+        if (*next < 0) {
+            *next = 0;
+        } else {
+            failure[*next] = 0;
+            queue[tail++] = *next;
+        }
+    }
+    while (head < tail) {
+        int state = queue[head++];
+        table->matches[state] |= table->matches[failure[state]];
+        for (int k = 0; k < numClasses; k++) {
+            int* next = &table->transitions[state * numClasses + k];
+            int fallback = table->transitions[failure[state] * numClasses + k];
+            if (*next < 0) {
+                *next = fallback;
+            } else {
+                failure[*next] = fallback;
+                queue[tail++] = *next;
+            }
+        }
+    }
+    free(failure);
+    free(queue);
+    
+    table->skip = &skipToFirstByte;
+#if GOD_X86_SIMD
+    __builtin_cpu_init();
+    if (table->numFirstBytes <= PRAYER_INTENT_PREFILTER && __builtin_cpu_supports("avx2") &&
+        __builtin_cpu_supports("bmi")) {
+        table->skip = &skipToFirstByteAvx2;
+    }
+#endif
+    
+    // Template prefixes never change, so they are matched once, here
+    for (int i = 0; i < PRAYER_TEMPLATE_COUNT; i++) {
+        const char* prefix = prayerTemplates[i].prefix;
+        table->templateState[i] = 0;
+        table->templateMatches[i] = matchIntentsFrom(table, (const unsigned char*)prefix, strlen(prefix),
+                                                     &table->templateState[i], 0);
+    }
+    
+    return table;
+}
+
+/**
+ * Free a compiled intent table
+ */
+void freePrayerIntents(PrayerIntents* intents) {
+    if (!intents) return;
+    
+    free(intents->transitions);
+    free(intents->matches);
+    free(intents->lifespanDays);
+    free(intents->entropyFactor);
+    free(intents);
+}
+
+/**
+ * Intents a prayer asks for - bit i set if intent i's phrase occurs in it
+ * One pass over the prayer: SIMD skips to the next byte that can start a
+ * phrase, the automaton steps through the rest.
+ */
+uint64_t prayerIntentsMatch(const PrayerIntents* intents, const char* prayer) {
+    if (!intents || !prayer) return 0;
+    
+    int state = 0;
+    return matchIntentsFrom(intents, (const unsigned char*)prayer, strlen(prayer), &state, 0);
+}
+
+/**
+ * Intents a template prayer of an entity of u asks for - exactly those of
+ * its rendered text, phrases spanning the name included
+ * Only the name and suffix are walked; the prefix was matched when the
+ * table was compiled. Returns 0 for an unknown template or entity.
+ */
+uint64_t prayerIntentsMatchTemplate(const PrayerIntents* intents, const TemplatePrayer* prayer,
+                                    const Universe* u) {
+    if (!intents || !prayer || !u) return 0;
+    if (prayer->templateId < 0 || prayer->templateId >= PRAYER_TEMPLATE_COUNT) return 0;
+    
+    int row = entityRowOf(u, prayer->entityId);
+    if (row < 0) return 0;
+    
+    const char* name = u->namePool + u->entityTable.nameOffset[row];
+    const char* suffix = prayerTemplates[prayer->templateId].suffix;
+    int state = intents->templateState[prayer->templateId];
+    uint64_t matched = matchIntentsFrom(intents, (const unsigned char*)name, strlen(name), &state,
+                                        intents->templateMatches[prayer->templateId]);
+    return matchIntentsFrom(intents, (const unsigned char*)suffix, strlen(suffix), &state, matched);
+}
+
+/**
+ * Intents divinePrayerResponse answers - compiled on first use
+ */
+static const PrayerIntent defaultIntentTable[] = {
+    { "guide me", 0, 0.99 } // Guidance reduces entropy
+};
+static PrayerIntents* defaultIntents;
+static pthread_once_t defaultIntentsOnce = PTHREAD_ONCE_INIT;
+
+static void compileDefaultIntents(void) {
+    defaultIntents = createPrayerIntents(defaultIntentTable,
+                                         (int)(sizeof(defaultIntentTable) / sizeof(defaultIntentTable[0])));
+}
+
+static const PrayerIntents* defaultPrayerIntents(void) {
+    pthread_once(&defaultIntentsOnce, &compileDefaultIntents);
+    return defaultIntents;
+}
+
+/**
+ * A miracle one day longer-lived, adjusted by every intent in `matched`
+ */
+static Universe* answerIntents(const PrayerIntents* intents, uint64_t matched, const Universe* u) {
+    Universe* newUniverse = divineMiracle(u, NULL);
+    if (!newUniverse) return NULL;
+    
+    newUniverse->totalLifespanDays += 1;
+    for (; matched; matched &= matched - 1) {
+        int i = __builtin_ctzll(matched);
+        newUniverse->totalLifespanDays += intents->lifespanDays[i];
+        newUniverse->entropyLevel *= intents->entropyFactor[i];
+    }
+    
+    return newUniverse;
+}
+
+/**
+ * Answer a prayer under an intent table - a miracle one day longer-lived,
+ * adjusted by every intent the prayer asks for
+ */
+Universe* prayerIntentsRespond(const PrayerIntents* intents, const ConsciousEntity* pray_er,
+                               const char* prayer, const Universe* u) {
+    if (!intents || !pray_er || !prayer || !u) return NULL;
+    
+    return answerIntents(intents, prayerIntentsMatch(intents, prayer), u);
+}
+
+/**
+ * Answer a template prayer under an intent table, as prayerIntentsRespond
+ * answers its rendered text - matched in place, no text formed
+ * Returns NULL for an unknown template or an entity not in u.
+ */
+Universe* prayerIntentsRespondTemplate(const PrayerIntents* intents, const TemplatePrayer* prayer,
+                                       const Universe* u) {
+    if (!intents || !prayer || !u) return NULL;
+    if (prayer->templateId < 0 || prayer->templateId >= PRAYER_TEMPLATE_COUNT) return NULL;
+    if (entityRowOf(u, prayer->entityId) < 0) return NULL;
+    
+    return answerIntents(intents, prayerIntentsMatchTemplate(intents, prayer, u), u);
+}
+
+/**
+ * Answer a batch of prayers under an intent table, folded into a single universe
+ * Equivalent to one miracle followed by each prayer's adjustment in turn:
+ * a day of lifespan per prayer plus the adjustments of every intent it asks
+ * for. Requests missing an entity or a prayer are ignored.
+ * Memory stays at one universe however many prayers are answered.
+ */
+Universe* prayerIntentsRespondBatch(const PrayerIntents* intents, const PrayerRequest* requests,
+                                    int count, const Universe* u) {
+    if (!intents || !requests || count <= 0 || !u) return NULL;
+    
+    int first = 0;
+    while (first < count && (!requests[first].pray_er || !requests[first].prayer)) first++;
+    if (first == count) return NULL;
+    
+    Universe* newUniverse = divineMiracle(u, NULL);
+    if (!newUniverse) return NULL;
+    
+    // Each prayer's adjustments in turn, in the order answerIntents applies them
+    for (int i = first; i < count; i++) {
+        if (!requests[i].pray_er || !requests[i].prayer) continue;
+        
+        newUniverse->totalLifespanDays += 1;
+        for (uint64_t matched = prayerIntentsMatch(intents, requests[i].prayer); matched; matched &= matched - 1) {
+            int intent = __builtin_ctzll(matched);
+            newUniverse->totalLifespanDays += intents->lifespanDays[intent];
+            newUniverse->entropyLevel *= intents->entropyFactor[intent];
+        }
+    }
+    
+    return newUniverse;
+}
+
+/**
+ * Divine response to prayer - answered under the default intents
+ */
+Universe* divinePrayerResponse(const ConsciousEntity* pray_er, const char* prayer, const Universe* u) {
+    const PrayerIntents* intents = defaultPrayerIntents();
+    if (!intents) return NULL;
+    
+    return prayerIntentsRespond(intents, pray_er, prayer, u);
+}
+
+/**
+ * Divine response to a template prayer - answered under the default intents
+ */
+Universe* divineTemplatePrayerResponse(const TemplatePrayer* prayer, const Universe* u) {
+    const PrayerIntents* intents = defaultPrayerIntents();
+    if (!intents) return NULL;
+    
+    return prayerIntentsRespondTemplate(intents, prayer, u);
+}
+
+/**
+ * Divine response to a batch of prayers, folded into a single universe -
+ * answered under the default intents, as prayerIntentsRespondBatch
+ */
+Universe* divinePrayerResponseBatch(const PrayerRequest* requests, int count, const Universe* u) {
+    const PrayerIntents* intents = defaultPrayerIntents();
+    if (!intents) return NULL;
+    
+    return prayerIntentsRespondBatch(intents, requests, count, u);
+}
+
+/* God's own store of truths - statements interned once into a string
+ * pool, found through an open-addressing index by their hash, with one bit
+ * of truth per statement */
+struct KnowledgeBase {
+    uint64_t* index;           // (statement hash << 32) | (id + 1) per slot, 0 when empty
+    size_t indexMask;
+    size_t* statementOffset;   // Offset of statement id in the pool
+    uint64_t* truths;          // Bit id % 64 of word id / 64: truth of statement id
+    size_t numStatements;
+    size_t capacity;           // Statements statementOffset and truths have room for
+    char* pool;                // Statements, NUL-terminated, back to back
+    size_t poolUsed;
+    size_t poolCapacity;
+};
+
+/* The knowledge base omniscienceFunction consults, if any - accessed
+ * atomically, like the divine clock */
+static const KnowledgeBase* divineKnowledge;
+
+/**
+ * Create an empty knowledge base
+ */
+KnowledgeBase* createKnowledgeBase(void) {
+    return (KnowledgeBase*)calloc(1, sizeof(KnowledgeBase));
+}
+
+/**
+ * Free a knowledge base - omniscienceFunction stops consulting it if it
+ * was the divine one, but a query already under way still reads it
+ */
+void freeKnowledgeBase(KnowledgeBase* kb) {
+    if (!kb) return;
+    
+    if (__atomic_load_n(&divineKnowledge, __ATOMIC_ACQUIRE) == kb) divineKnowledgeUse(NULL);
+    
+    free(kb->index);
+    free(kb->statementOffset);
+    free(kb->truths);
+    free(kb->pool);
+    free(kb);
+}
+
+/**
+ * Make room in a knowledge base for `statements` statements in total,
+ * taking up to `bytes` bytes of text, NULs included
+ * Lets a known body of knowledge be loaded without regrowing anything.
+ */
+bool knowledgeBaseReserve(KnowledgeBase* kb, size_t statements, size_t bytes) {
+    if (!kb || statements > INT_MAX) return false;
+    
+    if (statements > kb->capacity) {
+        size_t words = (statements + 63) / 64;
+        size_t* offsets = (size_t*)realloc(kb->statementOffset, sizeof(size_t) * statements);
+        if (!offsets) return false;
+        kb->statementOffset = offsets;
+        
+        uint64_t* truths = (uint64_t*)realloc(kb->truths, sizeof(uint64_t) * words);
+        if (!truths) return false;
+        size_t oldWords = (kb->capacity + 63) / 64;
+        memset(truths + oldWords, 0, sizeof(uint64_t) * (words - oldWords));
+        kb->truths = truths;
+        kb->capacity = statements;
+    }
+    if (!growHashIndex(&kb->index, &kb->indexMask, statements)) return false;
+    
+    if (bytes > kb->poolCapacity) {
+        char* pool = (char*)realloc(kb->pool, bytes);
+        if (!pool) return false;
+        kb->pool = pool;
+        kb->poolCapacity = bytes;
+    }
+    
+    return true;
+}
+
+/**
+ * Id of the `length`-byte statement at `statement`, whose hash is `tag`,
+ * in a knowledge base, or -1
+ */
+static long knowledgeFind(const KnowledgeBase* kb, const char* statement, size_t length, uint32_t tag) {
+    if (!kb->index) return -1;
+    
+    for (size_t slot = tag & kb->indexMask; kb->index[slot] != 0; slot = (slot + 1) & kb->indexMask) {
+        uint64_t entry = kb->index[slot];
+        if ((uint32_t)(entry >> 32) != tag) continue;
+        
+        size_t id = (size_t)(uint32_t)entry - 1;
+        const char* known = kb->pool + kb->statementOffset[id];
+        // The statement has no NUL, so a match stops short of the end of known
+        if (strncmp(known, statement, length) == 0 && known[length] == '\0') return (long)id;
+    }
+    
+    return -1;
+}
+
+/**
+ * Record the truth of the `length`-byte statement at `statement`, whose
+ * hash is `tag`, NUL-terminated or not - interned if new, updated if known
+ */
+static bool knowledgeRecord(KnowledgeBase* kb, const char* statement, size_t length, uint32_t tag, bool truth) {
+    long id = knowledgeFind(kb, statement, length, tag);
+    if (id < 0) {
+        // Double whatever is full, as the entity registry and name pool do
+        size_t statements = kb->numStatements < kb->capacity ? kb->capacity
+                          : kb->capacity >= KNOWLEDGE_MIN ? kb->capacity * 2 : KNOWLEDGE_MIN;
+        size_t bytes = kb->poolCapacity;
+        while (bytes - kb->poolUsed < length + 1) bytes = bytes >= NAME_POOL_MIN ? bytes * 2 : NAME_POOL_MIN;
+        if (!knowledgeBaseReserve(kb, statements, bytes) && !knowledgeBaseReserve(kb, kb->numStatements + 1,
+                                                                                  kb->poolUsed + length + 1)) {
+            return false;
+        }
+        
+        id = (long)kb->numStatements++;
+        kb->statementOffset[id] = kb->poolUsed;
+        memcpy(kb->pool + kb->poolUsed, statement, length);
+        kb->pool[kb->poolUsed + length] = '\0';
+        kb->poolUsed += length + 1;
+        
+        size_t slot = tag & kb->indexMask;
+        while (kb->index[slot] != 0) slot = (slot + 1) & kb->indexMask;
+        kb->index[slot] = ((uint64_t)tag << 32) | (uint32_t)(id + 1);
+    }
+    
+    uint64_t bit = (uint64_t)1 << (id % 64);
+    if (truth) kb->truths[id / 64] |= bit;
+    else kb->truths[id / 64] &= ~bit;
+    
+    return true;
+}
+
+/**
+ * Tell a knowledge base whether a statement is true
+ * Returns false if out of memory or the knowledge base is full.
+ */
+bool knowledgeBaseAssert(KnowledgeBase* kb, const char* statement, bool truth) {
+    if (!kb || !statement) return false;
+    
+    size_t length = strlen(statement);
+    return knowledgeRecord(kb, statement, length, hashBytes(statement, length), truth);
+}
+
+/**
+ * Ask a knowledge base about a statement - true if it knows it, with its
+ * truth in *truth; one hash and, almost always, one index probe
+ * Safe from any number of threads while no one asserts or loads.
+ */
+bool knowledgeBaseQuery(const KnowledgeBase* kb, const char* statement, bool* truth) {
+    if (!kb || !statement || !truth) return false;
+    
+    size_t length = strlen(statement);
+    long id = knowledgeFind(kb, statement, length, hashBytes(statement, length));
+    if (id < 0) return false;
+    
+    *truth = (kb->truths[id / 64] >> (id % 64)) & 1;
+    return true;
+}
+
+/**
+ * Number of statements a knowledge base knows
+ */
+size_t knowledgeBaseSize(const KnowledgeBase* kb) {
+    return kb ? kb->numStatements : 0;
+}
+
+/**
+ * Load statements into a knowledge base from a file, one per line as
+ * "1 statement" or "0 statement" for true and false
+ * The file is mapped, scanned for newlines with SIMD where available and
+ * the knowledge base sized once for all of it. Lines of any other form, or
+ * holding a NUL, are skipped, and a trailing '\r' is dropped; later lines
+ * override earlier ones about the same statement. Returns the number of
+ * lines loaded, or -1 if the file can not be read or the knowledge base
+ * can not hold it.
+ */
+long knowledgeBaseLoad(KnowledgeBase* kb, const char* path) {
+    if (!kb || !path) return -1;
+    
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    
+    struct stat status;
+    if (fstat(fd, &status) != 0) {
+        close(fd);
+        return -1;
+    }
+    size_t size = (size_t)status.st_size;
+    if (size == 0) {
+        close(fd);
+        return 0;
+    }
+    
+    const char* data = (const char*)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file alive
+    if (data == MAP_FAILED) return -1;
+    posix_madvise((void*)data, size, POSIX_MADV_SEQUENTIAL);
+    
+    // Every line may be a new statement, taking at most the file's bytes
+    const NewlineScanner* scanner = selectNewlineScanner();
+    size_t lines = scanner->count(data, size) + (data[size - 1] != '\n');
+    if (!knowledgeBaseReserve(kb, kb->numStatements + lines, kb->poolUsed + size + 1)) {
+        munmap((void*)data, size);
+        return -1;
+    }
+    
+    // Statements are interned straight from the mapping, hashed
+    // NAME_LOOKUP_PREFETCH lines ahead of their insert with the slot prefetched
+    struct {
+        const char* statement;
+        size_t length;
+        uint32_t tag;
+        bool truth;
+    } pending[NAME_LOOKUP_PREFETCH];
+    long parsed = 0;
+    long loaded = 0;
+    const char* end = data + size;
+    for (const char* line = data; line < end || parsed > loaded; ) {
+        if (parsed - loaded == NAME_LOOKUP_PREFETCH || line >= end) {
+            int k = (int)(loaded % NAME_LOOKUP_PREFETCH);
+            if (!knowledgeRecord(kb, pending[k].statement, pending[k].length, pending[k].tag, pending[k].truth)) break;
+            loaded++;
+            continue;
+        }
+        
+        const char* newline = scanner->next(line, end);
+        size_t length = (size_t)(newline - line);
+        if (length > 0 && line[length - 1] == '\r') length--;
+        
+        if (length > 2 && (line[0] == '0' || line[0] == '1') && line[1] == ' ' &&
+            !memchr(line + 2, '\0', length - 2)) {
+            int k = (int)(parsed % NAME_LOOKUP_PREFETCH);
+            pending[k].statement = line + 2;
+            pending[k].length = length - 2;
+            pending[k].tag = hashBytes(line + 2, length - 2);
+            pending[k].truth = line[0] == '1';
+            __builtin_prefetch(&kb->index[pending[k].tag & kb->indexMask]);
+            parsed++;
+        }
+        line = newline + 1;
+    }
+    
+    munmap((void*)data, size);
+    return loaded;
+}
+
+/**
+ * Let omniscienceFunction consult a knowledge base - NULL to stop
+ * The knowledge base must not change while other threads may query it.
+ */
+void divineKnowledgeUse(const KnowledgeBase* kb) {
+    __atomic_store_n(&divineKnowledge, kb, __ATOMIC_RELEASE);
+}
+
+/**
+ * Omniscience function - knows the truth value of any proposition
+ * Answers from the knowledge base chosen with divineKnowledgeUse, if any
+ */
+bool omniscienceFunction(const Proposition* p) {
+    if (!p) return false;
     
-    // Create a prayer based on entity's name with proper buffer length check
-    char* prayer = (char*)malloc(MAX_PRAYER_LENGTH);
-    if (!prayer) return NULL;
+    // Statements in the divine knowledge base are known by heart
+    bool truth;
+    if (p->statement && knowledgeBaseQuery(__atomic_load_n(&divineKnowledge, __ATOMIC_ACQUIRE),
+                                           p->statement, &truth)) return truth;
     
-    // Use snprintf to prevent buffer overflow
-    int result = snprintf(prayer, MAX_PRAYER_LENGTH, 
-                         "Prayer from %s: Please guide me.", entity->name);
+    // Anything else falls back to the "hidden" truth the proposition carries
+    return p->truthValue;
+}
+
+/**
+ * Omnipotence function - can actualize any logically consistent state
+ */
+bool omnipotenceFunction(const State* s) {
+    if (!s) return false;
     
-    // Check if snprintf was successful
-    if (result < 0 || result >= MAX_PRAYER_LENGTH) {
-        free(prayer);
+    return s->isLogicallyConsistent;
+}
+
+/**
+ * Divine love function - maximum positive connection
+ */
+double divineLove(const ConsciousEntity* e) {
+    if (!e) return 0.0;
+    
+    // Maximum love for each entity
+    return INFINITY_REPRESENTATION;
+}
+
+/**
+ * Divine revelation function - FIXED: NULL check for memory allocation
+ */
+void* divineRevelation(const Universe* u, const TimePoint* t) {
+    if (!u || !t) return NULL;
+    
+    // Create a revelation object (simplified)
+    void* revelation = malloc(sizeof(double));
+    if (!revelation) return NULL;
+    
+    *(double*)revelation = 1.0;
+    
+    return revelation;
+}
+
+/**
+ * Divine ontological dependence function
+ */
+bool divineOntoDependence(const void* existent) {
+    // Everything depends ontologically on God
+    (void)existent; // Suppress unused parameter warning
+    return true;
+}
+
+/**
+ * Divine universe completion function
+ */
+Universe* divineCompletion(const Universe* u) {
+    if (!u) return NULL;
+    
+    // Create a completed version of the universe - using the miracle function
+    // as it already forks the universe
+    Universe* completedUniverse = divineMiracle(u, NULL);
+    if (!completedUniverse) return NULL;
+    
+    // Transform to completed state - set entropy to maximum
+    completedUniverse->entropyLevel = completedUniverse->maxEntropy;
+    
+    return completedUniverse;
+}
+
+/**
+ * Divine multiverse projection function - God's view over a Multiverse:
+ * its population, mean entropy and the first end of the world in it
+ * Returns a MultiverseProjection to release with freeProjection
+ */
+void* divineMultiverseProjection(const void* multiverse) {
+    if (!multiverse) return NULL;
+    
+    const Multiverse* m = (const Multiverse*)multiverse;
+    MultiverseProjection* projection = (MultiverseProjection*)malloc(sizeof(MultiverseProjection));
+    long* days = (long*)malloc(sizeof(long) * (size_t)(m->count > 0 ? m->count : 1));
+    if (!projection || !days) {
+        free(projection);
+        free(days);
+        return NULL;
+    }
+    
+    multiverseEndOfWorld(NULL, m, days);
+    
+    projection->universes = m->count;
+    projection->entities = 0;
+    projection->earliestEndOfWorld = -1;
+    double entropy = 0.0;
+    for (int i = 0; i < m->count; i++) {
+        projection->entities += m->universes[i]->numEntities;
+        entropy += m->universes[i]->entropyLevel;
+        if (projection->earliestEndOfWorld < 0 || days[i] < projection->earliestEndOfWorld) {
+            projection->earliestEndOfWorld = days[i];
+        }
+    }
+    projection->meanEntropy = m->count > 0 ? entropy / m->count : 0.0;
+    
+    free(days);
+    return projection;
+}
+
+/* A range of loop iterations waiting to run */
+typedef struct SchedulerTask {
+    int begin;
+    int end;
+} SchedulerTask;
+
+/* One worker of a scheduler and its deque - the owner pushes and pops at the
+ * bottom, thieves steal from the top. Padded so neighbours share no line. */
+typedef struct GOD_CACHE_ALIGNED SchedulerWorker {
+    pthread_mutex_t lock;
+    SchedulerTask tasks[SCHEDULER_DEQUE_SIZE];
+    unsigned top;         // Next task to steal
+    unsigned bottom;      // One past the task the owner pops next
+    unsigned randomState; // Picks steal victims
+    DivineScheduler* scheduler;
+} SchedulerWorker;
+
+/* Work-stealing scheduler - worker 0 is the thread calling divineParallelFor */
+struct DivineScheduler {
+    int numWorkers;
+    SchedulerWorker* workers;
+    pthread_t* threads; // Workers 1..numWorkers-1
+    
+    /* Job hand-off between the caller and the worker threads */
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    unsigned long generation; // Bumped for every job
+    int activeWorkers;        // Worker threads still inside the current job
+    bool shuttingDown;
+    
+    /* The current job */
+    void (*body)(void* context, int begin, int end);
+    void* context;
+    int grain;
+    long remaining; // Iterations not run yet
+};
+
+/**
+ * Push a task onto the bottom of a worker's own deque
+ */
+static bool pushSchedulerTask(SchedulerWorker* w, SchedulerTask task) {
+    pthread_mutex_lock(&w->lock);
+    bool pushed = w->bottom - w->top < SCHEDULER_DEQUE_SIZE;
+    if (pushed) {
+        w->tasks[w->bottom % SCHEDULER_DEQUE_SIZE] = task;
+        w->bottom++;
+    }
+    pthread_mutex_unlock(&w->lock);
+    
+    return pushed;
+}
+
+/**
+ * Pop the most recently pushed task of a worker's own deque
+ */
+static bool popSchedulerTask(SchedulerWorker* w, SchedulerTask* task) {
+    pthread_mutex_lock(&w->lock);
+    bool popped = w->bottom != w->top;
+    if (popped) {
+        w->bottom--;
+        *task = w->tasks[w->bottom % SCHEDULER_DEQUE_SIZE];
+    }
+    pthread_mutex_unlock(&w->lock);
+    
+    return popped;
+}
+
+/**
+ * Steal the oldest - and so largest - task of another worker
+ */
+static bool stealSchedulerTask(DivineScheduler* s, SchedulerWorker* thief, SchedulerTask* task) {
+    // xorshift picks where to start looking, so thieves spread over victims
+    thief->randomState ^= thief->randomState << 13;
+    thief->randomState ^= thief->randomState >> 17;
+    thief->randomState ^= thief->randomState << 5;
+    
+    int start = (int)(thief->randomState % (unsigned)s->numWorkers);
+    for (int i = 0; i < s->numWorkers; i++) {
+        SchedulerWorker* victim = &s->workers[(start + i) % s->numWorkers];
+        if (victim == thief) continue;
+        
+        pthread_mutex_lock(&victim->lock);
+        bool stolen = victim->bottom != victim->top;
+        if (stolen) {
+            *task = victim->tasks[victim->top % SCHEDULER_DEQUE_SIZE];
+            victim->top++;
+        }
+        pthread_mutex_unlock(&victim->lock);
+        
+        if (stolen) return true;
+    }
+    
+    return false;
+}
+
+/**
+ * Run a task, first splitting off its upper halves for thieves until it
+ * is no larger than the grain
+ */
+static void runSchedulerTask(DivineScheduler* s, SchedulerWorker* self, SchedulerTask task) {
+    while (task.end - task.begin > s->grain) {
+        int middle = task.begin + (task.end - task.begin) / 2;
+        SchedulerTask upper = { middle, task.end };
+        if (!pushSchedulerTask(self, upper)) break; // Deque full - run the rest here
+        task.end = middle;
+    }
+    
+    s->body(s->context, task.begin, task.end);
+    __atomic_sub_fetch(&s->remaining, (long)(task.end - task.begin), __ATOMIC_RELEASE);
+}
+
+/**
+ * Work on the current job until every iteration has run
+ */
+static void runSchedulerJob(DivineScheduler* s, SchedulerWorker* self) {
+    while (__atomic_load_n(&s->remaining, __ATOMIC_ACQUIRE) > 0) {
+        SchedulerTask task;
+        if (popSchedulerTask(self, &task) || stealSchedulerTask(s, self, &task)) {
+            runSchedulerTask(s, self, task);
+        } else {
+            sched_yield(); // Everything left is being run elsewhere
+        }
+    }
+}
+
+/**
+ * Worker thread - sleeps between jobs, helps with each one
+ */
+static void* schedulerThreadMain(void* argument) {
+    SchedulerWorker* self = (SchedulerWorker*)argument;
+    DivineScheduler* s = self->scheduler;
+    unsigned long seenGeneration = 0;
+    
+    pthread_mutex_lock(&s->lock);
+    for (;;) {
+        while (s->generation == seenGeneration && !s->shuttingDown) {
+            pthread_cond_wait(&s->wake, &s->lock);
+        }
+        if (s->shuttingDown) break;
+        seenGeneration = s->generation;
+        pthread_mutex_unlock(&s->lock);
+        
+        runSchedulerJob(s, self);
+        
+        pthread_mutex_lock(&s->lock);
+        if (--s->activeWorkers == 0) {
+            pthread_cond_signal(&s->done);
+        }
+    }
+    pthread_mutex_unlock(&s->lock);
+    
+    return NULL;
+}
+
+/**
+ * Create a work-stealing scheduler with `numThreads` workers, counting the
+ * calling thread; 0 means one per online CPU
+ */
+DivineScheduler* createDivineScheduler(int numThreads) {
+    if (numThreads < 0) return NULL;
+    if (numThreads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        numThreads = cpus > 0 ? (int)cpus : 1;
+    }
+    
+    DivineScheduler* s = (DivineScheduler*)malloc(sizeof(DivineScheduler));
+    if (!s) return NULL;
+    
+    s->numWorkers = numThreads;
+    s->generation = 0;
+    s->activeWorkers = 0;
+    s->shuttingDown = false;
+    s->remaining = 0;
+    s->threads = NULL;
+    
+    // Workers are cache-line aligned, which plain malloc does not promise
+    void* workers = NULL;
+    if (posix_memalign(&workers, CACHE_LINE_SIZE, sizeof(SchedulerWorker) * (size_t)numThreads) != 0) {
+        free(s);
+        return NULL;
+    }
+    s->workers = (SchedulerWorker*)workers;
+    
+    if (numThreads > 1) {
+        s->threads = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)(numThreads - 1));
+        if (!s->threads) {
+            free(s->workers);
+            free(s);
+            return NULL;
+        }
+    }
+    
+    for (int i = 0; i < numThreads; i++) {
+        pthread_mutex_init(&s->workers[i].lock, NULL);
+        s->workers[i].top = 0;
+        s->workers[i].bottom = 0;
+        s->workers[i].randomState = 2654435761u * (unsigned)(i + 1);
+        s->workers[i].scheduler = s;
+    }
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->wake, NULL);
+    pthread_cond_init(&s->done, NULL);
+    
+    for (int i = 1; i < numThreads; i++) {
+        if (pthread_create(&s->threads[i - 1], NULL, &schedulerThreadMain, &s->workers[i]) != 0) {
+            // Run with the workers that did start
+            s->numWorkers = i;
+            break;
+        }
+    }
+    
+    return s;
+}
+
+/**
+ * Stop the worker threads and free a scheduler
+ */
+void freeDivineScheduler(DivineScheduler* s) {
+    if (!s) return;
+    
+    pthread_mutex_lock(&s->lock);
+    s->shuttingDown = true;
+    pthread_cond_broadcast(&s->wake);
+    pthread_mutex_unlock(&s->lock);
+    
+    for (int i = 1; i < s->numWorkers; i++) {
+        pthread_join(s->threads[i - 1], NULL);
+    }
+    
+    for (int i = 0; i < s->numWorkers; i++) {
+        pthread_mutex_destroy(&s->workers[i].lock);
+    }
+    pthread_mutex_destroy(&s->lock);
+    pthread_cond_destroy(&s->wake);
+    pthread_cond_destroy(&s->done);
+    
+    free(s->threads);
+    free(s->workers);
+    free(s);
+}
+
+/**
+ * Number of threads, the caller included, that run a scheduler's jobs
+ */
+int divineSchedulerThreads(const DivineScheduler* s) {
+    return s ? s->numWorkers : 0;
+}
+
+/**
+ * Run body(context, b, e) over disjoint subranges covering [begin, end)
+ * Ranges are split in halves down to `grain` iterations; idle workers steal
+ * the largest pending halves. Returns once every iteration has run. One job
+ * at a time per scheduler; a NULL scheduler runs the loop on the caller.
+ */
+void divineParallelFor(DivineScheduler* s, int begin, int end, int grain,
+                       void (*body)(void* context, int begin, int end), void* context) {
+    if (!body || end <= begin) return;
+    if (grain < 1) grain = 1;
+    
+    if (!s || s->numWorkers == 1 || end - begin <= grain) {
+        body(context, begin, end);
+        return;
+    }
+    
+    s->body = body;
+    s->context = context;
+    s->grain = grain;
+    s->remaining = (long)end - begin;
+    SchedulerTask root = { begin, end };
+    pushSchedulerTask(&s->workers[0], root);
+    
+    pthread_mutex_lock(&s->lock);
+    s->activeWorkers = s->numWorkers - 1;
+    s->generation++;
+    pthread_cond_broadcast(&s->wake);
+    pthread_mutex_unlock(&s->lock);
+    
+    runSchedulerJob(s, &s->workers[0]);
+    
+    // No worker may still be touching the job when the caller moves on
+    pthread_mutex_lock(&s->lock);
+    while (s->activeWorkers > 0) {
+        pthread_cond_wait(&s->done, &s->lock);
+    }
+    pthread_mutex_unlock(&s->lock);
+}
+
+/* Shared state of a prayer sweep */
+typedef struct PrayerSweep {
+    God* god;
+    const Universe* universe;
+    PrayerOutcome* outcomes;
+    int failures;
+} PrayerSweep;
+
+/**
+ * Prayer sweep over one range of entities: batch-form their prayers, answer
+ * each one and let its entity choose
+ * A God answering with the default divinePrayerResponse is handed template
+ * prayers, so no prayer text is formed at all.
+ */
+static void prayerSweepRange(void* context, int begin, int end) {
+    PrayerSweep* sweep = (PrayerSweep*)context;
+    const Universe* u = sweep->universe;
+    int count = end - begin;
+    int failures = 0;
+    
+    if (sweep->god->respondToPrayer == &divinePrayerResponse) {
+        for (int i = begin; i < end; i++) {
+            ConsciousEntity* entity = u->consciousEntities[i];
+            PrayerOutcome* outcome = &sweep->outcomes[i];
+            
+            TemplatePrayer prayer;
+            formTemplatePrayer(entity, &prayer);
+            outcome->response = divineTemplatePrayerResponse(&prayer, u);
+            
+            State options = { outcome->response, NULL, outcome->response != NULL };
+            outcome->choice = entity->makeChoice(&options);
+            
+            if (!outcome->response) failures++;
+        }
+        if (failures > 0) {
+            __atomic_add_fetch(&sweep->failures, failures, __ATOMIC_RELAXED);
+        }
+        return;
+    }
+    
+    size_t arenaSize = formPrayerBatch(u, begin, count, NULL, 0, NULL);
+    char* arena = (char*)malloc(arenaSize);
+    size_t* offsets = (size_t*)malloc(sizeof(size_t) * (size_t)count);
+    if (!arena || !offsets || formPrayerBatch(u, begin, count, arena, arenaSize, offsets) != arenaSize) {
+        free(arena);
+        free(offsets);
+        for (int i = begin; i < end; i++) {
+            sweep->outcomes[i].response = NULL;
+            sweep->outcomes[i].choice = false;
+        }
+        __atomic_add_fetch(&sweep->failures, count, __ATOMIC_RELAXED);
+        return;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        ConsciousEntity* entity = u->consciousEntities[begin + i];
+        PrayerOutcome* outcome = &sweep->outcomes[begin + i];
+        
+        outcome->response = godRespondToPrayer(sweep->god, entity, arena + offsets[i], u);
+        
+        // The entity chooses whether to live in the answered universe
+        State options = { outcome->response, NULL, outcome->response != NULL };
+        outcome->choice = entity->makeChoice(&options);
+        
+        if (!outcome->response) failures++;
+    }
+    
+    free(arena);
+    free(offsets);
+    if (failures > 0) {
+        __atomic_add_fetch(&sweep->failures, failures, __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * Every entity of a universe prays, God answers and the entity chooses,
+ * spread over the scheduler's threads
+ * outcomes[i] receives the answer to consciousEntities[i] - the caller frees
+ * each response universe. Returns false if any prayer went unanswered.
+ */
+bool divinePrayerSweep(DivineScheduler* s, God* g, const Universe* u, PrayerOutcome* outcomes) {
+    if (!g || !u || !outcomes) return false;
+    
+    PrayerSweep sweep = { g, u, outcomes, 0 };
+    divineParallelFor(s, 0, u->numEntities, PRAYER_SWEEP_GRAIN, &prayerSweepRange, &sweep);
+    
+    return sweep.failures == 0;
+}
+
+/**
+ * Create an empty multiverse with room for `capacity` universes
+ */
+Multiverse* createMultiverse(int capacity) {
+    if (capacity < 0) return NULL;
+    
+    Multiverse* m = (Multiverse*)malloc(sizeof(Multiverse));
+    if (!m) return NULL;
+    
+    m->universes = NULL;
+    m->count = 0;
+    m->capacity = 0;
+    if (capacity > 0) {
+        m->universes = (Universe**)malloc(sizeof(Universe*) * (size_t)capacity);
+        if (!m->universes) {
+            free(m);
+            return NULL;
+        }
+        m->capacity = capacity;
+    }
+    
+    return m;
+}
+
+/**
+ * Free a multiverse together with every universe it owns
+ */
+void freeMultiverse(Multiverse* m) {
+    if (!m) return;
+    
+    for (int i = 0; i < m->count; i++) {
+        freeUniverse(m->universes[i]);
+    }
+    free(m->universes);
+    free(m);
+}
+
+/**
+ * Make room in a multiverse for `n` more universes, doubling as it grows
+ */
+static bool reserveMultiverse(Multiverse* m, int n) {
+    if (n > INT_MAX - m->count) return false;
+    if (m->count + n <= m->capacity) return true;
+    
+    int capacity = m->capacity > 0 ? m->capacity : 16;
+    while (capacity < m->count + n) {
+        capacity = capacity > INT_MAX / 2 ? INT_MAX : capacity * 2;
+    }
+    
+    Universe** universes = (Universe**)realloc(m->universes, sizeof(Universe*) * (size_t)capacity);
+    if (!universes) return false;
+    
+    m->universes = universes;
+    m->capacity = capacity;
+    return true;
+}
+
+/**
+ * Hand a universe over to a multiverse, which frees it with itself
+ * Returns the universe's index, or -1 if out of memory
+ */
+int multiverseAdd(Multiverse* m, Universe* u) {
+    if (!m || !u || !reserveMultiverse(m, 1)) return -1;
+    
+    m->universes[m->count] = u;
+    return m->count++;
+}
+
+/**
+ * Create `n` universes in a multiverse at once - arena universes, one
+ * allocation each, appended to the registry
+ * Returns the index of the first, or -1 - creating none - if out of memory
+ */
+int multiverseCreateUniverses(Multiverse* m, int n) {
+    if (!m || n < 0 || !reserveMultiverse(m, n)) return -1;
+    
+    int first = m->count;
+    for (int i = 0; i < n; i++) {
+        Universe* u = divineCreateUniverseArena();
+        if (!u) {
+            for (int j = first; j < first + i; j++) freeUniverse(m->universes[j]);
+            return -1;
+        }
+        m->universes[first + i] = u;
+    }
+    m->count += n;
+    
+    return first;
+}
+
+/**
+ * Take a universe out of a multiverse, handing it back to the caller
+ * The last universe moves into its index to keep the registry dense.
+ */
+Universe* multiverseRemove(Multiverse* m, int index) {
+    if (!m || index < 0 || index >= m->count) return NULL;
+    
+    Universe* u = m->universes[index];
+    m->universes[index] = m->universes[--m->count];
+    
+    return u;
+}
+
+/* A multiverse loop body and its context, run over ranges of universes */
+typedef struct MultiverseLoop {
+    Multiverse* multiverse;
+    void (*body)(void* context, Universe* u, int index);
+    void* context;
+} MultiverseLoop;
+
+static void multiverseLoopRange(void* context, int begin, int end) {
+    MultiverseLoop* loop = (MultiverseLoop*)context;
+    for (int i = begin; i < end; i++) {
+        loop->body(loop->context, loop->multiverse->universes[i], i);
+    }
+}
+
+/**
+ * Run body(context, universe, index) for every universe of a multiverse,
+ * spread over the scheduler's threads (NULL runs it on the caller)
+ * Each universe is visited exactly once; the registry must not change meanwhile.
+ */
+void multiverseForEach(DivineScheduler* s, Multiverse* m,
+                       void (*body)(void* context, Universe* u, int index), void* context) {
+    if (!m || !body) return;
+    
+    MultiverseLoop loop = { m, body, context };
+    divineParallelFor(s, 0, m->count, MULTIVERSE_GRAIN, &multiverseLoopRange, &loop);
+}
+
+/* Shared state of a bulk evolution */
+typedef struct MultiverseEvolution {
+    const Multiverse* multiverse;
+    const TimePoint* time;
+    double* evolution;
+} MultiverseEvolution;
+
+static void multiverseEvolveRange(void* context, int begin, int end) {
+    MultiverseEvolution* run = (MultiverseEvolution*)context;
+    for (int i = begin; i < end; i++) {
+        const Universe* u = run->multiverse->universes[i];
+        run->evolution[i] = u->naturalLaws.evolve ? u->naturalLaws.evolve(run->time) : 0.0;
+    }
+}
+
+/**
+ * Evolve every universe of a multiverse under its natural laws at time t,
+ * spread over the scheduler's threads - evolution[i] receives universe i's result
+ */
+void multiverseEvolve(DivineScheduler* s, const Multiverse* m, const TimePoint* t, double* evolution) {
+    if (!m || !evolution) return;
+    
+    MultiverseEvolution run = { m, t, evolution };
+    divineParallelFor(s, 0, m->count, MULTIVERSE_GRAIN, &multiverseEvolveRange, &run);
+}
+
+/**
+ * Batch form of a universe's natural laws, or NULL to call evolve per point
+ * The built-in batch law only stands in for the built-in evolve, so a
+ * universe whose evolve was replaced on its own keeps its custom law.
+ */
+static EvolveBatchKernel universeBatchLaw(const Universe* u) {
+    EvolveBatchKernel batch = u->naturalLaws.evolveBatch;
+    if (batch == &universeEvolveBatchFunction && u->naturalLaws.evolve != &universeEvolveFunction) {
         return NULL;
     }
     
-    return prayer;
+    return batch;
 }
 
 /**
- * Always returns true - used for divine necessary existence
+ * Evolve a universe under its natural laws at `count` time points -
+ * evolution[i] receives the result at t[i]
+ * Uses naturalLaws.evolveBatch when it matches evolve, else calls evolve
+ * per time point. Returns false if the universe has no natural laws.
  */
-bool alwaysTrue() {
+bool universeEvolveBatch(const Universe* u, const TimePoint* t, int count, double* evolution) {
+    if (!u || !t || !evolution || count < 0) return false;
+    
+    EvolveBatchKernel batch = universeBatchLaw(u);
+    if (batch) {
+        batch(t, count, evolution);
+        return true;
+    }
+    if (!u->naturalLaws.evolve) return false;
+    
+    for (int i = 0; i < count; i++) {
+        evolution[i] = u->naturalLaws.evolve(&t[i]);
+    }
     return true;
 }
 
 /**
- * Trinity equality function - paradoxical equality
+ * Advance a universe through `steps` temporal coordinates, start + k * step
+ * for k = 0..steps-1 - evolution[k] receives the result at step k
+ * Time points are generated and evolved EVOLVE_BATCH at a time, so long
+ * histories cost one evolveBatch call per batch rather than one call per step.
+ * Returns false if the universe has no natural laws.
  */
-bool trinityEquality(const void* p1, const void* p2) {
-    // In trinitarian concept, persons are distinct yet one
-    // This is a simplified representation of that paradox
-    return true; // All persons are equal in essence
+bool universeEvolveSteps(const Universe* u, double start, double step, int steps, double* evolution) {
+    if (!u || !evolution || steps < 0) return false;
+    if (!universeBatchLaw(u) && !u->naturalLaws.evolve) return false;
+    
+    TimePoint batch[EVOLVE_BATCH];
+    for (int first = 0; first < steps; first += EVOLVE_BATCH) {
+        int count = steps - first < EVOLVE_BATCH ? steps - first : EVOLVE_BATCH;
+        for (int k = 0; k < count; k++) {
+            // From the start each time, so rounding does not accumulate over the history
+            batch[k].temporalCoordinate = start + (double)(first + k) * step;
+            batch[k].isInEternity = false;
+        }
+        universeEvolveBatch(u, batch, count, evolution + first);
+    }
+    
+    return true;
 }
 
-/**
- * Divine projection into space - omnipresence
- */
-void divineProjectIntoSpace(const void* space) {
-    // Symbolic implementation of omnipresence
-    // No actual operation needed in this simulation
-    (void)space; // Suppress unused parameter warning
+/* Shared state of a multiverse time-stepping run */
+typedef struct MultiverseStepping {
+    const Multiverse* multiverse;
+    double start;
+    double step;
+    int steps;
+    double* evolution;
+} MultiverseStepping;
+
+static void multiverseEvolveStepsRange(void* context, int begin, int end) {
+    MultiverseStepping* run = (MultiverseStepping*)context;
+    for (int i = begin; i < end; i++) {
+        double* history = run->evolution + (size_t)i * (size_t)run->steps;
+        if (!universeEvolveSteps(run->multiverse->universes[i], run->start, run->step, run->steps, history)) {
+            memset(history, 0, sizeof(double) * (size_t)run->steps);
+        }
+    }
 }
 
 /**
- * Divine projection into time - atemporality
+ * Advance every universe of a multiverse through `steps` temporal
+ * coordinates, as universeEvolveSteps, spread over the scheduler's threads
+ * evolution holds count * steps results, universe i's history at
+ * evolution[i * steps]; universes without natural laws get zeros.
  */
-void divineProjectIntoTime(const TimePoint* t) {
-    // Symbolic implementation of atemporality
-    // No actual operation needed in this simulation
-    (void)t; // Suppress unused parameter warning
+void multiverseEvolveSteps(DivineScheduler* s, const Multiverse* m, double start, double step,
+                           int steps, double* evolution) {
+    if (!m || !evolution || steps <= 0) return;
+    
+    // About MULTIVERSE_GRAIN steps per task, whatever the history length
+    int grain = steps >= MULTIVERSE_GRAIN ? 1 : MULTIVERSE_GRAIN / steps;
+    MultiverseStepping run = { m, start, step, steps, evolution };
+    divineParallelFor(s, 0, m->count, grain, &multiverseEvolveStepsRange, &run);
 }
 
-/**
- * Divine justice evaluation
- */
-double divineJusticeEvaluation(void* moralFramework) {
-    // Perfect justice
-    (void)moralFramework; // Suppress unused parameter warning
-    return INFINITY_REPRESENTATION;
+/* Shared state of a bulk end-of-world countdown */
+typedef struct MultiverseEschatology {
+    const Multiverse* multiverse;
+    long* daysRemaining;
+    time_t now;
+} MultiverseEschatology;
+
+static void multiverseEndOfWorldRange(void* context, int begin, int end) {
+    MultiverseEschatology* run = (MultiverseEschatology*)context;
+    calculateEndOfWorldBatchAt((const Universe* const*)run->multiverse->universes + begin,
+                               end - begin, run->daysRemaining + begin, run->now);
 }
 
 /**
- * Divine compatibility with free will
+ * Days until the end of the world for every universe of a multiverse,
+ * judged at one instant with the SIMD batch kernels and spread over the
+ * scheduler's threads - daysRemaining[i] receives universe i's countdown
  */
-bool divineFreeWillCompatibility(const ConsciousEntity* e, void* choice) {
-    // God's omnipotence is compatible with genuine free will
-    (void)e;      // Suppress unused parameter warning
-    (void)choice; // Suppress unused parameter warning
-    return true;
+void multiverseEndOfWorld(DivineScheduler* s, const Multiverse* m, long* daysRemaining) {
+    if (!m || !daysRemaining) return;
+    
+    MultiverseEschatology run = { m, daysRemaining, divineClockNow() };
+    divineParallelFor(s, 0, m->count, MULTIVERSE_GRAIN, &multiverseEndOfWorldRange, &run);
 }
 
+/* One slot of a prayer queue - its sequence says whose turn it is:
+ * position when free for a producer, position + 1 once holding a prayer */
+typedef struct PrayerQueueSlot {
+    unsigned long sequence;
+    PrayerRequest request;
+} PrayerQueueSlot;
+
+/* Bounded lock-free prayer intake - many producers, one consumer
+ * The producers' and the consumer's positions sit on separate cache lines
+ * so submissions do not bounce the line the consumer is draining from. */
+struct PrayerQueue {
+    PrayerQueueSlot* slots;
+    unsigned long mask; // Capacity - 1, capacity being a power of two
+    
+    unsigned long tail GOD_CACHE_ALIGNED; // Next position producers claim
+    unsigned long dropped;                // Prayers refused because the queue was full
+    
+    unsigned long head GOD_CACHE_ALIGNED; // Next position the consumer drains
+};
+
 /**
- * Divine miracle - intervention in natural laws
+ * Create a prayer queue holding at least `capacity` prayers
+ * The capacity is rounded up to a power of two.
  */
-Universe* divineMiracle(const Universe* u, const TimePoint* t) {
-    if (!u) return NULL;
-    (void)t; // Suppress unused parameter warning
-    
-    // Create a modified universe state
-    Universe* newUniverse = (Universe*)malloc(sizeof(Universe));
-    if (!newUniverse) return NULL;
+PrayerQueue* createPrayerQueue(int capacity) {
+    if (capacity <= 0) return NULL;
     
-    // Initialize with NULL to handle cleanup on error
-    newUniverse->physicalConstants = NULL;
-    newUniverse->spacetime = NULL;
-    newUniverse->matter = NULL;
-    newUniverse->energy = NULL;
-    newUniverse->consciousEntities = NULL;
+    unsigned long slotCount = 1;
+    while (slotCount < (unsigned long)capacity) slotCount <<= 1;
     
-    // Copy universe state - FIXED: deep copy instead of memcpy
+    // The queue is cache-line aligned, which plain malloc does not promise
+    void* memory = NULL;
+    if (posix_memalign(&memory, CACHE_LINE_SIZE, sizeof(PrayerQueue)) != 0) return NULL;
+    PrayerQueue* q = (PrayerQueue*)memory;
     
-    // Copy physical constants
-    newUniverse->numConstants = u->numConstants;
-    newUniverse->physicalConstants = (double*)malloc(sizeof(double) * u->numConstants);
-    if (!newUniverse->physicalConstants) {
-        free(newUniverse);
+    q->slots = (PrayerQueueSlot*)malloc(sizeof(PrayerQueueSlot) * slotCount);
+    if (!q->slots) {
+        free(q);
         return NULL;
     }
-    memcpy(newUniverse->physicalConstants, u->physicalConstants, 
-           sizeof(double) * u->numConstants);
     
-    // Copy spacetime
-    newUniverse->spacetime = malloc(sizeof(double) * 4);
-    if (!newUniverse->spacetime) {
-        free(newUniverse->physicalConstants);
-        free(newUniverse);
-        return NULL;
+    for (unsigned long i = 0; i < slotCount; i++) {
+        q->slots[i].sequence = i;
     }
-    memcpy(newUniverse->spacetime, u->spacetime, sizeof(double) * 4);
+    q->mask = slotCount - 1;
+    q->tail = 0;
+    q->dropped = 0;
+    q->head = 0;
     
-    // Copy matter
-    newUniverse->matter = malloc(sizeof(double));
-    if (!newUniverse->matter) {
-        free(newUniverse->spacetime);
-        free(newUniverse->physicalConstants);
-        free(newUniverse);
-        return NULL;
-    }
-    memcpy(newUniverse->matter, u->matter, sizeof(double));
+    return q;
+}
+
+/**
+ * Free a prayer queue - prayers still queued are discarded, not answered
+ */
+void freePrayerQueue(PrayerQueue* q) {
+    if (!q) return;
     
-    // Copy energy
-    newUniverse->energy = malloc(sizeof(double));
-    if (!newUniverse->energy) {
-        free(newUniverse->matter);
-        free(newUniverse->spacetime);
-        free(newUniverse->physicalConstants);
-        free(newUniverse);
-        return NULL;
+    free(q->slots);
+    free(q);
+}
+
+/**
+ * Submit a prayer without blocking - safe from any number of threads
+ * The prayer is not copied and must stay alive until it has been drained.
+ * Returns false, counting a drop, if the queue is full.
+ */
+bool prayerQueueSubmit(PrayerQueue* q, const ConsciousEntity* pray_er, const char* prayer) {
+    if (!q || !pray_er || !prayer) return false;
+    
+    unsigned long position = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+    PrayerQueueSlot* slot;
+    for (;;) {
+        slot = &q->slots[position & q->mask];
+        unsigned long sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+        long lag = (long)(sequence - position);
+        
+        if (lag == 0) {
+            // Slot is free - claim the position, or learn the newer tail on failure
+            if (__atomic_compare_exchange_n(&q->tail, &position, position + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (lag < 0) {
+            // The consumer has not freed this slot yet - the queue is full
+            __atomic_add_fetch(&q->dropped, 1, __ATOMIC_RELAXED);
+            return false;
+        } else {
+            // Another producer claimed the position first
+            position = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+        }
     }
-    memcpy(newUniverse->energy, u->energy, sizeof(double));
-    
-    // Copy other universe properties
-    newUniverse->naturalLaws.evolve = u->naturalLaws.evolve;
-    newUniverse->creationTime = u->creationTime;
-    newUniverse->totalLifespanDays = u->totalLifespanDays;
-    newUniverse->entropyLevel = u->entropyLevel;
-    newUniverse->maxEntropy = u->maxEntropy;
     
-    // Conscious entities are more complex - for simplicity, don't copy them
-    newUniverse->numEntities = 0;
-    newUniverse->consciousEntities = NULL;
+    slot->request.pray_er = pray_er;
+    slot->request.prayer = prayer;
+    __atomic_store_n(&slot->sequence, position + 1, __ATOMIC_RELEASE);
     
-    // Make a "miraculous" change - reduce entropy as an intervention
-    newUniverse->entropyLevel *= 0.9; // Reduce entropy by 10%
-    
-    return newUniverse;
+    return true;
 }
 
 /**
- * Divine response to prayer
+ * Answer up to `maxPrayers` queued prayers (all of them if 0) with the God's
+ * respondToPrayer against universe u, in batches of PRAYER_QUEUE_BATCH
+ * Each batch is copied out and its slots handed back to the producers before
+ * any prayer is answered. answered(context, request, response) receives each
+ * response and owns it; with no callback the responses are freed. Only one
+ * thread may drain a queue at a time. Returns the number of prayers drained.
  */
-Universe* divinePrayerResponse(const ConsciousEntity* pray_er, const char* prayer, const Universe* u) {
-    if (!pray_er || !prayer || !u) return NULL;
-    
-    // Create a modified universe as response to prayer
-    // Simply call the miracle function as a simplified implementation
-    Universe* newUniverse = divineMiracle(u, NULL);
-    
-    // If the prayer came through successfully, modify the universe slightly
-    if (newUniverse) {
-        // Simple modification - increase universe lifespan slightly
-        newUniverse->totalLifespanDays += 1;
+int prayerQueueDrain(PrayerQueue* q, God* g, const Universe* u, int maxPrayers,
+                     void (*answered)(void* context, const PrayerRequest* request, Universe* response),
+                     void* context) {
+    if (!q || !g || !u || maxPrayers < 0) return 0;
+    
+    PrayerRequest batch[PRAYER_QUEUE_BATCH];
+    unsigned long position = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+    int drained = 0;
+    
+    while (maxPrayers == 0 || drained < maxPrayers) {
+        // Take a batch off the queue
+        int count = 0;
+        while (count < PRAYER_QUEUE_BATCH && (maxPrayers == 0 || drained + count < maxPrayers)) {
+            PrayerQueueSlot* slot = &q->slots[position & q->mask];
+            if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != position + 1) break;
+            
+            batch[count++] = slot->request;
+            __atomic_store_n(&slot->sequence, position + q->mask + 1, __ATOMIC_RELEASE);
+            position++;
+        }
+        __atomic_store_n(&q->head, position, __ATOMIC_RELAXED);
+        if (count == 0) break;
         
-        // Placeholder for more complex response logic
-        if (strstr(prayer, "guide me") != NULL) {
-            // Prayer asks for guidance - further reduce entropy
-            newUniverse->entropyLevel *= 0.99;
+        // Answer it while producers refill the freed slots
+        for (int i = 0; i < count; i++) {
+            Universe* response = godRespondToPrayer(g, batch[i].pray_er, batch[i].prayer, u);
+            if (answered) {
+                answered(context, &batch[i], response);
+            } else {
+                freeUniverse(response);
+            }
         }
+        drained += count;
     }
     
-    return newUniverse;
+    return drained;
 }
 
 /**
- * Omniscience function - knows the truth value of any proposition
+ * Prayers waiting in a queue - a snapshot, as producers keep submitting
  */
-bool omniscienceFunction(const Proposition* p) {
-    if (!p) return false;
+unsigned long prayerQueueDepth(const PrayerQueue* q) {
+    if (!q) return 0;
     
-    // In reality, this would need access to all truth
-    // This is just a placeholder that accesses the "hidden" truth
-    return p->truthValue;
+    unsigned long head = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+    unsigned long tail = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+    
+    // Claimed positions count as queued; a stale head can not make depth exceed capacity
+    unsigned long depth = tail - head;
+    if ((long)depth < 0) return 0;
+    return depth > q->mask + 1 ? q->mask + 1 : depth;
 }
 
 /**
- * Omnipotence function - can actualize any logically consistent state
+ * Prayers refused since the queue was created because it was full
  */
-bool omnipotenceFunction(const State* s) {
-    if (!s) return false;
-    
-    return s->isLogicallyConsistent;
+unsigned long prayerQueueDropped(const PrayerQueue* q) {
+    return q ? __atomic_load_n(&q->dropped, __ATOMIC_RELAXED) : 0;
 }
 
+/* Where one section of a snapshot lies in the file */
+typedef struct SnapshotSection {
+    uint64_t offset;
+    uint64_t size;
+} SnapshotSection;
+
+/* Header of a universe snapshot - the universe's scalar state and the
+ * location of each array. Sections follow, each aligned to
+ * SNAPSHOT_ALIGNMENT, in the byte order and type sizes of the writer. */
+typedef struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t fileSize;
+    int64_t creationTime;
+    int64_t totalLifespanDays;
+    double entropyLevel;
+    double maxEntropy;
+    double spacetime[SPACETIME_DIMENSIONS];
+    double matter;
+    double energy;
+    uint64_t numConstants;
+    uint64_t numEntities;
+    uint64_t nameIndexMask;        // Name index slots - 1, 0 without entities
+    SnapshotSection constants;     // double[numConstants]
+    SnapshotSection consciousness; // double[numEntities] - the entity table columns, as in memory
+    SnapshotSection freeWill;      // double[numEntities]
+    SnapshotSection uniqueId;      // int32_t[numEntities]
+    SnapshotSection nameOffset;    // uint64_t[numEntities], offsets into the name pool
+    SnapshotSection namePool;      // NUL-terminated names, back to back
+    SnapshotSection nameIndex;     // uint64_t[nameIndexMask + 1], sized for numEntities
+} SnapshotHeader;
+
 /**
- * Divine love function - maximum positive connection
+ * Lay out a section of `size` bytes at the next aligned offset
  */
-double divineLove(const ConsciousEntity* e) {
-    if (!e) return 0.0;
+static SnapshotSection placeSnapshotSection(uint64_t* cursor, uint64_t size) {
+    SnapshotSection section;
+    section.offset = (*cursor + SNAPSHOT_ALIGNMENT - 1) & ~(uint64_t)(SNAPSHOT_ALIGNMENT - 1);
+    section.size = size;
+    *cursor = section.offset + size;
     
-    // Maximum love for each entity
-    return INFINITY_REPRESENTATION;
+    return section;
 }
 
 /**
- * Divine revelation function - FIXED: NULL check for memory allocation
+ * Write a section's bytes after padding the file out to its offset
  */
-void* divineRevelation(const Universe* u, const TimePoint* t) {
-    if (!u || !t) return NULL;
+static bool writeSnapshotSection(FILE* out, uint64_t* written, SnapshotSection section, const void* data) {
+    static const char padding[SNAPSHOT_ALIGNMENT] = { 0 };
+    size_t pad = (size_t)(section.offset - *written);
+    if (pad > 0 && fwrite(padding, 1, pad, out) != pad) return false;
+    if (section.size > 0 && fwrite(data, 1, (size_t)section.size, out) != section.size) return false;
     
-    // Create a revelation object (simplified)
-    void* revelation = malloc(sizeof(double));
-    if (!revelation) return NULL;
-    
-    *(double*)revelation = 1.0;
-    
-    return revelation;
+    *written = section.offset + section.size;
+    return true;
 }
 
 /**
- * Divine ontological dependence function
+ * Save a universe, its entities and their names to a snapshot file
+ * The file is written next to `path` and renamed over it when complete, so
+ * an interrupted save leaves any earlier snapshot intact. Returns false on
+ * an I/O error.
  */
-bool divineOntoDependence(const void* existent) {
-    // Everything depends ontologically on God
-    (void)existent; // Suppress unused parameter warning
-    return true;
+bool saveUniverseSnapshot(const Universe* u, const char* path) {
+    if (!u || !path) return false;
+    
+    // The table columns go to the file as they are in memory
+    if (sizeof(size_t) != sizeof(uint64_t) || sizeof(int) != sizeof(int32_t)) return false;
+    
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byteOrder = SNAPSHOT_BYTE_ORDER;
+    header.creationTime = (int64_t)u->creationTime;
+    header.totalLifespanDays = u->totalLifespanDays;
+    header.entropyLevel = u->entropyLevel;
+    header.maxEntropy = u->maxEntropy;
+    memcpy(header.spacetime, u->spacetime, sizeof(header.spacetime));
+    header.matter = *(const double*)u->matter;
+    header.energy = *(const double*)u->energy;
+    header.numConstants = (uint64_t)u->numConstants;
+    header.numEntities = (uint64_t)u->numEntities;
+    
+    // The name index goes to the file sized for the live entities, not for
+    // the table's spare capacity
+    uint64_t rows = (uint64_t)u->numEntities;
+    size_t indexSlots = rows > 0 ? hashIndexSlots((size_t)rows) : 0;
+    const uint64_t* nameIndex = u->nameIndex;
+    uint64_t* compacted = NULL;
+    if (rows > 0 && indexSlots != u->nameIndexMask + 1) {
+        compacted = rehashIndex(u->nameIndex, u->nameIndexMask, indexSlots);
+        if (!compacted) return false;
+        nameIndex = compacted;
+    }
+    header.nameIndexMask = rows > 0 ? (uint64_t)(indexSlots - 1) : 0;
+    
+    uint64_t cursor = sizeof(header);
+    header.constants = placeSnapshotSection(&cursor, sizeof(double) * header.numConstants);
+    header.consciousness = placeSnapshotSection(&cursor, sizeof(double) * rows);
+    header.freeWill = placeSnapshotSection(&cursor, sizeof(double) * rows);
+    header.uniqueId = placeSnapshotSection(&cursor, sizeof(int32_t) * rows);
+    header.nameOffset = placeSnapshotSection(&cursor, sizeof(uint64_t) * rows);
+    header.namePool = placeSnapshotSection(&cursor, u->namePoolUsed);
+    header.nameIndex = placeSnapshotSection(&cursor, sizeof(uint64_t) * indexSlots);
+    header.fileSize = cursor;
+    
+    size_t pathLength = strlen(path);
+    char* partial = (char*)malloc(pathLength + sizeof(".partial"));
+    if (!partial) {
+        free(compacted);
+        return false;
+    }
+    memcpy(partial, path, pathLength);
+    memcpy(partial + pathLength, ".partial", sizeof(".partial"));
+    
+    FILE* out = fopen(partial, "wb");
+    if (!out) {
+        free(partial);
+        free(compacted);
+        return false;
+    }
+    
+    const EntityTable* table = &u->entityTable;
+    uint64_t written = sizeof(header);
+    bool saved = fwrite(&header, sizeof(header), 1, out) == 1 &&
+                 writeSnapshotSection(out, &written, header.constants, u->physicalConstants) &&
+                 writeSnapshotSection(out, &written, header.consciousness, table->consciousness) &&
+                 writeSnapshotSection(out, &written, header.freeWill, table->freeWill) &&
+                 writeSnapshotSection(out, &written, header.uniqueId, table->uniqueId) &&
+                 writeSnapshotSection(out, &written, header.nameOffset, table->nameOffset) &&
+                 writeSnapshotSection(out, &written, header.namePool, u->namePool) &&
+                 writeSnapshotSection(out, &written, header.nameIndex, nameIndex);
+    saved = fclose(out) == 0 && saved;
+    saved = saved && rename(partial, path) == 0;
+    
+    if (!saved) remove(partial);
+    free(partial);
+    free(compacted);
+    return saved;
 }
 
 /**
- * Divine universe completion function
+ * Whether a section lies aligned inside the file and holds `count` items of `itemSize`
  */
-Universe* divineCompletion(const Universe* u) {
-    if (!u) return NULL;
+static bool snapshotSectionValid(const SnapshotHeader* header, SnapshotSection section,
+                                 uint64_t count, size_t itemSize) {
+    if (section.offset % SNAPSHOT_ALIGNMENT != 0) return false;
+    if (section.offset > header->fileSize || section.size > header->fileSize - section.offset) return false;
     
-    // Create a completed version of the universe - using the miracle function
-    // as it already has the deep copy logic
-    Universe* completedUniverse = divineMiracle(u, NULL);
-    if (!completedUniverse) return NULL;
+    return itemSize == 0 || section.size == count * itemSize;
+}
+
+/**
+ * Check a mapped snapshot's header against the file it came from
+ */
+static bool snapshotHeaderValid(const SnapshotHeader* header, size_t fileSize) {
+    if (memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0) return false;
+    if (header->version != SNAPSHOT_VERSION || header->byteOrder != SNAPSHOT_BYTE_ORDER) return false;
+    if (header->fileSize != fileSize) return false;
+    if (header->numConstants == 0 || header->numConstants > INT_MAX) return false;
+    if (header->numEntities > INT_MAX) return false;
+    
+    uint64_t rows = header->numEntities;
+    if (!snapshotSectionValid(header, header->constants, header->numConstants, sizeof(double)) ||
+        !snapshotSectionValid(header, header->consciousness, rows, sizeof(double)) ||
+        !snapshotSectionValid(header, header->freeWill, rows, sizeof(double)) ||
+        !snapshotSectionValid(header, header->uniqueId, rows, sizeof(int32_t)) ||
+        !snapshotSectionValid(header, header->nameOffset, rows, sizeof(uint64_t)) ||
+        !snapshotSectionValid(header, header->namePool, 0, 0)) {
+        return false;
+    }
     
-    // Transform to completed state - set entropy to maximum
-    completedUniverse->entropyLevel = completedUniverse->maxEntropy;
+    // The name index is exactly the size a save gives it for this many rows
+    uint64_t indexSlots = rows > 0 ? (uint64_t)hashIndexSlots((size_t)rows) : 0;
+    if (header->nameIndexMask != (rows > 0 ? indexSlots - 1 : 0) ||
+        !snapshotSectionValid(header, header->nameIndex, indexSlots, sizeof(uint64_t))) {
+        return false;
+    }
     
-    return completedUniverse;
+    // Every name ends inside the pool once the pool ends in a NUL
+    const char* pool = (const char*)header + header->namePool.offset;
+    return header->namePool.size == 0 ? rows == 0 : pool[header->namePool.size - 1] == '\0';
 }
 
+/* Universe whose entity records a snapshot load is fixing up */
+typedef struct SnapshotFixup {
+    Universe* universe;
+    bool corrupt;        // A name offset or index slot pointed outside the table
+    size_t emptySlots;   // Free slots of the mapped name index
+} SnapshotFixup;
+
 /**
- * Divine multiverse projection function - FIXED: NULL check for memory allocation
+ * Point the records of rows [begin, end) of a loaded universe at their
+ * mapped table row and name
  */
-void* divineMultiverseProjection(const void* multiverse) {
-    if (!multiverse) return NULL;
+static void fixUpSnapshotRange(void* context, int begin, int end) {
+    SnapshotFixup* fixup = (SnapshotFixup*)context;
+    Universe* u = fixup->universe;
+    const EntityTable* table = &u->entityTable;
+    ConsciousEntity* records = u->entitySlabs->entities;
+    
+    for (int i = begin; i < end; i++) {
+        if (table->nameOffset[i] >= u->namePoolUsed) {
+            __atomic_store_n(&fixup->corrupt, true, __ATOMIC_RELAXED);
+            return;
+        }
+        
+        bindEntityRecord(u, &records[i], i);
+        u->consciousEntities[i] = &records[i];
+    }
+}
+
+/**
+ * Check blocks [begin, end) of SNAPSHOT_INDEX_BLOCK slots of a loaded
+ * universe's mapped name index - every entry names a row of the table
+ */
+static void checkSnapshotIndexRange(void* context, int begin, int end) {
+    SnapshotFixup* fixup = (SnapshotFixup*)context;
+    const Universe* u = fixup->universe;
+    size_t slots = u->nameIndexMask + 1;
+    size_t last = (size_t)end * SNAPSHOT_INDEX_BLOCK < slots ? (size_t)end * SNAPSHOT_INDEX_BLOCK : slots;
+    
+    size_t empty = 0;
+    for (size_t slot = (size_t)begin * SNAPSHOT_INDEX_BLOCK; slot < last; slot++) {
+        uint64_t entry = u->nameIndex[slot];
+        if (entry == 0) {
+            empty++;
+        } else if ((uint32_t)entry > (uint32_t)u->entityCapacity) {
+            __atomic_store_n(&fixup->corrupt, true, __ATOMIC_RELAXED);
+            return;
+        }
+    }
+    __atomic_fetch_add(&fixup->emptySlots, empty, __ATOMIC_RELAXED);
+}
+
+/**
+ * Load a universe from a snapshot file
+ * The file is mapped copy-on-write and the entity table columns, name
+ * pool and name index are used in place - nothing is parsed or hashed.
+ * Only the entity records are built, one pointer fix-up pass over the
+ * table and one bounds check over the index, spread over the threads of
+ * scheduler s (NULL runs it on the caller). Writes to entity
+ * attributes stay in memory; the file is never modified. The columns move
+ * to memory of their own when the population first grows. Returns NULL
+ * if the file is missing, truncated, from another snapshot version or
+ * host type, or out of memory.
+ */
+Universe* loadUniverseSnapshot(const char* path, DivineScheduler* s) {
+    if (!path) return NULL;
+    if (sizeof(size_t) != sizeof(uint64_t) || sizeof(int) != sizeof(int32_t)) return NULL;
     
-    // Project into multiverse (simplified)
-    void* projection = malloc(sizeof(void*));
-    if (!projection) return NULL;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
     
-    return projection;
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size < (off_t)sizeof(SnapshotHeader)) {
+        close(fd);
+        return NULL;
+    }
+    size_t fileSize = (size_t)status.st_size;
+    
+    void* mapping = mmap(NULL, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file alive
+    if (mapping == MAP_FAILED) return NULL;
+    
+    const SnapshotHeader* header = (const SnapshotHeader*)mapping;
+    Universe* u = snapshotHeaderValid(header, fileSize) ? divineCreateUniverse() : NULL;
+    double* constants = u ? (double*)allocatePayload(sizeof(double) * header->numConstants) : NULL;
+    int rows = u ? (int)header->numEntities : 0;
+    bool ready = constants != NULL;
+    if (ready && rows > 0) {
+        // Room for the registry and records; the table columns need none
+        u->consciousEntities = (ConsciousEntity**)malloc(sizeof(ConsciousEntity*) * (size_t)rows);
+        ready = u->consciousEntities && addEntitySlab(u, rows);
+    }
+    if (!ready) {
+        releasePayload(constants);
+        freeUniverse(u);
+        munmap(mapping, fileSize);
+        return NULL;
+    }
+    
+    char* base = (char*)mapping;
+    memcpy(constants, base + header->constants.offset, sizeof(double) * header->numConstants);
+    releasePayload(u->physicalConstants);
+    u->physicalConstants = constants;
+    u->numConstants = (int)header->numConstants;
+    u->constantsVersion++;
+    refreshPhysicalInfluence(u);
+    
+    memcpy(u->spacetime, header->spacetime, sizeof(header->spacetime));
+    *(double*)u->matter = header->matter;
+    *(double*)u->energy = header->energy;
+    u->creationTime = (time_t)header->creationTime;
+    u->totalLifespanDays = (long)header->totalLifespanDays;
+    u->entropyLevel = header->entropyLevel;
+    u->maxEntropy = header->maxEntropy;
+    
+    if (rows == 0) {
+        munmap(mapping, fileSize);
+        return u;
+    }
+    
+    // The columns and the pool are the mapped sections themselves
+    EntityTable* table = &u->entityTable;
+    table->consciousness = (double*)(base + header->consciousness.offset);
+    table->freeWill = (double*)(base + header->freeWill.offset);
+    table->uniqueId = (int*)(base + header->uniqueId.offset);
+    table->nameOffset = (size_t*)(base + header->nameOffset.offset);
+    u->namePool = base + header->namePool.offset;
+    u->namePoolUsed = (size_t)header->namePool.size;
+    u->namePoolCapacity = u->namePoolUsed;
+    u->nameIndex = (uint64_t*)(base + header->nameIndex.offset);
+    u->nameIndexMask = (size_t)header->nameIndexMask;
+    u->snapshotMapping = mapping;
+    u->snapshotMappingSize = fileSize;
+    u->entityCapacity = rows;
+    
+    // Fix up the records over the mapped rows, and check the mapped index
+    // can neither point past them nor send a probe around forever
+    SnapshotFixup fixup = { u, false, 0 };
+    int indexBlocks = (int)((u->nameIndexMask + SNAPSHOT_INDEX_BLOCK) / SNAPSHOT_INDEX_BLOCK);
+    divineParallelFor(s, 0, rows, SNAPSHOT_FIXUP_GRAIN, &fixUpSnapshotRange, &fixup);
+    divineParallelFor(s, 0, indexBlocks, 1, &checkSnapshotIndexRange, &fixup);
+    if (fixup.corrupt || fixup.emptySlots == 0) {
+        freeUniverse(u); // Unmaps the file as well
+        return NULL;
+    }
+    u->entitySlabs->used = rows;
+    u->numEntities = rows;
+    
+    return u;
 }
 
 /**
@@ -783,29 +3757,40 @@ void* divineMultiverseProjection(const void* multiverse) {
 void freeUniverse(Universe* u) {
     if (!u) return;
     
-    // Free physical constants
-    free(u->physicalConstants);
-    
-    // Free spacetime, matter, and energy
-    free(u->spacetime);
-    free(u->matter);
-    free(u->energy);
-    
-    // Free all conscious entities
-    for (int i = 0; i < u->numEntities; i++) {
-        if (u->consciousEntities[i]) {
-            free(u->consciousEntities[i]->consciousness);
-            free(u->consciousEntities[i]->freeWill);
-            free(u->consciousEntities[i]->name);
-            free(u->consciousEntities[i]);
-        }
+    // Drop this universe's references to its (possibly shared) payload
+    releasePayload(u->physicalConstants);
+    releasePayload(u->spacetime);
+    releasePayload(u->matter);
+    releasePayload(u->energy);
+    
+    // Free all conscious entities - records live in slabs, names in the pool
+    EntitySlab* slab = u->entitySlabs;
+    while (slab) {
+        EntitySlab* next = slab->next;
+        free(slab);
+        slab = next;
     }
-    
-    // Free the entity array
     free(u->consciousEntities);
     
-    // Free the universe itself
-    free(u);
+    // Free the columns of the entity table, the name pool and the name
+    // index - or the snapshot mapping they live in
+    if (u->snapshotMapping) {
+        munmap(u->snapshotMapping, u->snapshotMappingSize);
+    } else {
+        free(u->nameIndex);
+        free(u->namePool);
+        free(u->entityTable.consciousness);
+        free(u->entityTable.freeWill);
+        free(u->entityTable.uniqueId);
+        free(u->entityTable.nameOffset);
+    }
+    
+    // Free the universe itself - an arena block goes once its payload is unshared
+    if (u->layout == UNIVERSE_LAYOUT_ARENA) {
+        releaseArena(universeArena(u));
+    } else {
+        free(u);
+    }
 }
 
 /**
@@ -829,104 +3814,282 @@ void freeGod(God* g) {
     free(g);
 }
 
+/* The parameters of a GOD_ATTRIBUTES entry without its leading God, which
+ * the function pointers do not take */
+#define DIVINE_WITHOUT_GOD(...) DIVINE_WITHOUT_GOD_PICK(__VA_ARGS__, 4, 3, 2, 1, 0)(__VA_ARGS__)
+#define DIVINE_WITHOUT_GOD_PICK(g, a, b, c, count, ...) DIVINE_WITHOUT_GOD_##count
+#define DIVINE_WITHOUT_GOD_1(g) (void)
+#define DIVINE_WITHOUT_GOD_2(g, a) (a)
+#define DIVINE_WITHOUT_GOD_3(g, a, b) (a, b)
+#define DIVINE_WITHOUT_GOD_4(g, a, b, c) (a, b, c)
+
+/* Attribute indices into the dispatch statistics */
+typedef enum {
+#define DIVINE_ATTRIBUTE_ID(Name, member, binding, type, parameters, arguments) DIVINE_ATTRIBUTE_##Name,
+    GOD_ATTRIBUTES(DIVINE_ATTRIBUTE_ID)
+    GOD_VOID_ATTRIBUTES(DIVINE_ATTRIBUTE_ID)
+#undef DIVINE_ATTRIBUTE_ID
+    DIVINE_ATTRIBUTE_COUNT
+} DivineAttribute;
+
+static const char* const divineAttributeNames[DIVINE_ATTRIBUTE_COUNT] = {
+#define DIVINE_ATTRIBUTE_NAME(Name, member, binding, type, parameters, arguments) #Name,
+    GOD_ATTRIBUTES(DIVINE_ATTRIBUTE_NAME)
+    GOD_VOID_ATTRIBUTES(DIVINE_ATTRIBUTE_NAME)
+#undef DIVINE_ATTRIBUTE_NAME
+};
+
+/* Calls and latency of one attribute - a log-linear (HDR-style) histogram
+ * in nanoseconds: exact below 16 ns, then 16 buckets per power of two */
+typedef struct GOD_CACHE_ALIGNED DispatchStats {
+    unsigned long totalNs;
+    unsigned long maxNs;
+    unsigned long buckets[LATENCY_BUCKETS];
+} DispatchStats;
+
+static DispatchStats dispatchStats[DIVINE_ATTRIBUTE_COUNT];
+
+/* The God's own implementations behind the instrumentation wrappers,
+ * shared by every instrumented God */
+static struct {
+#define DIVINE_ORIGINAL(Name, member, binding, type, parameters, arguments) type (*Name) DIVINE_WITHOUT_GOD parameters;
+    GOD_ATTRIBUTES(DIVINE_ORIGINAL)
+    GOD_VOID_ATTRIBUTES(DIVINE_ORIGINAL)
+#undef DIVINE_ORIGINAL
+} dispatchOriginals;
+
+/**
+ * Monotonic time in nanoseconds for dispatch timing
+ */
+static unsigned long dispatchNowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long)ts.tv_sec * 1000000000ul + (unsigned long)ts.tv_nsec;
+}
+
 /**
- * Main function - a metaphorical simulation of creation and divine interaction
+ * Histogram bucket of a latency
  */
-int main() {
-    printf("Starting divine simulation...\n");
+static int latencyBucket(unsigned long ns) {
+    if (ns < (1ul << LATENCY_SUB_BITS)) return (int)ns;
     
-    // Instantiate God
-    God* omega = createGod();
-    if (!omega) {
-        printf("Failed to create God instance\n");
-        return 1;
-    }
-    
-    printf("God instance created - divine attributes initialized\n");
+    int exponent = 63 - __builtin_clzl(ns);
+    if (exponent > LATENCY_MAX_EXPONENT) return LATENCY_BUCKETS - 1;
     
-    // Creation
-    Universe* universe = omega->createUniverse();
-    if (!universe) {
-        printf("Universe creation failed\n");
-        freeGod(omega);
-        return 1;
-    }
+    int sub = (int)(ns >> (exponent - LATENCY_SUB_BITS)) & ((1 << LATENCY_SUB_BITS) - 1);
+    return ((exponent - LATENCY_SUB_BITS + 1) << LATENCY_SUB_BITS) + sub;
+}
+
+/**
+ * Highest latency a histogram bucket stands for
+ */
+static unsigned long latencyBucketLimit(int bucket) {
+    if (bucket < (1 << LATENCY_SUB_BITS)) return (unsigned long)bucket;
     
-    printf("Universe created with %d physical constants\n", universe->numConstants);
+    int exponent = (bucket >> LATENCY_SUB_BITS) + LATENCY_SUB_BITS - 1;
+    unsigned long sub = (unsigned long)(bucket & ((1 << LATENCY_SUB_BITS) - 1));
+    unsigned long width = 1ul << (exponent - LATENCY_SUB_BITS);
     
-    // Create time
-    TimePoint beginning = {0.0, false};
+    return ((1ul << LATENCY_SUB_BITS) + sub) * width + width - 1;
+}
+
+/**
+ * Record one call of an attribute that took `ns` nanoseconds
+ */
+static void recordLatency(DivineAttribute attribute, unsigned long ns) {
+    DispatchStats* stats = &dispatchStats[attribute];
     
-    // Create humans
-    ConsciousEntity* human1 = createConsciousEntity(omega, universe, "Human1");
-    ConsciousEntity* human2 = createConsciousEntity(omega, universe, "Human2");
+    __atomic_add_fetch(&stats->totalNs, ns, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&stats->buckets[latencyBucket(ns)], 1, __ATOMIC_RELAXED);
     
-    if (!human1 || !human2) {
-        printf("Failed to create conscious entities\n");
-        freeUniverse(universe);
-        freeGod(omega);
-        return 1;
+    unsigned long max = __atomic_load_n(&stats->maxNs, __ATOMIC_RELAXED);
+    while (ns > max && !__atomic_compare_exchange_n(&stats->maxNs, &max, ns, true,
+                                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+/**
+ * Record one call of an attribute that started at `start`
+ */
+static void recordDispatch(DivineAttribute attribute, unsigned long start) {
+    recordLatency(attribute, dispatchNowNs() - start);
+}
+
+/* Instrumentation wrappers - time the original implementation and record it */
+#define DIVINE_WRAPPER(Name, member, binding, type, parameters, arguments) \
+    static type instrumented_##Name DIVINE_WITHOUT_GOD parameters { \
+        unsigned long start = dispatchNowNs(); \
+        type result = dispatchOriginals.Name arguments; \
+        recordDispatch(DIVINE_ATTRIBUTE_##Name, start); \
+        return result; \
+    }
+#define DIVINE_VOID_WRAPPER(Name, member, binding, type, parameters, arguments) \
+    static void instrumented_##Name DIVINE_WITHOUT_GOD parameters { \
+        unsigned long start = dispatchNowNs(); \
+        dispatchOriginals.Name arguments; \
+        recordDispatch(DIVINE_ATTRIBUTE_##Name, start); \
+    }
+GOD_ATTRIBUTES(DIVINE_WRAPPER)
+GOD_VOID_ATTRIBUTES(DIVINE_VOID_WRAPPER)
+#undef DIVINE_WRAPPER
+#undef DIVINE_VOID_WRAPPER
+
+/**
+ * Route every function pointer of a God through call counting and latency
+ * histograms - a God that is never instrumented pays nothing
+ * All instrumented Gods share one set of original implementations, so this
+ * fails, changing nothing, for a God whose implementations differ from
+ * those of a God instrumented before. Not thread-safe: instrument a God
+ * before sharing it with other threads.
+ */
+bool divineInstrument(God* g) {
+    if (!g) return false;
+    
+#define DIVINE_CHECK_ORIGINAL(Name, member, binding, type, parameters, arguments) \
+    if (g->member && g->member != &instrumented_##Name && \
+        dispatchOriginals.Name && g->member != dispatchOriginals.Name) return false;
+    GOD_ATTRIBUTES(DIVINE_CHECK_ORIGINAL)
+    GOD_VOID_ATTRIBUTES(DIVINE_CHECK_ORIGINAL)
+#undef DIVINE_CHECK_ORIGINAL
+    
+    // Attributes the God lacks stay NULL rather than wrapping nothing
+#define DIVINE_WRAP(Name, member, binding, type, parameters, arguments) \
+    if (g->member && g->member != &instrumented_##Name) { \
+        dispatchOriginals.Name = g->member; \
+        g->member = &instrumented_##Name; \
     }
+    GOD_ATTRIBUTES(DIVINE_WRAP)
+    GOD_VOID_ATTRIBUTES(DIVINE_WRAP)
+#undef DIVINE_WRAP
     
-    printf("Created conscious entities: %s and %s\n", human1->name, human2->name);
+    return true;
+}
+
+/**
+ * Give an instrumented God its original implementations back
+ */
+void divineUninstrument(God* g) {
+    if (!g) return;
     
-    // Divine-human relationship
-    printf("Divine love for %s: %f (conceptual infinity)\n", 
-           human1->name, omega->loveIntensityFor(human1));
+#define DIVINE_UNWRAP(Name, member, binding, type, parameters, arguments) \
+    if (g->member == &instrumented_##Name) g->member = dispatchOriginals.Name;
+    GOD_ATTRIBUTES(DIVINE_UNWRAP)
+    GOD_VOID_ATTRIBUTES(DIVINE_UNWRAP)
+#undef DIVINE_UNWRAP
+}
+
+/**
+ * Forget every call recorded so far
+ */
+void divineStatsReset(void) {
+    for (int a = 0; a < DIVINE_ATTRIBUTE_COUNT; a++) {
+        DispatchStats* stats = &dispatchStats[a];
+        __atomic_store_n(&stats->totalNs, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&stats->maxNs, 0, __ATOMIC_RELAXED);
+        for (int b = 0; b < LATENCY_BUCKETS; b++) {
+            __atomic_store_n(&stats->buckets[b], 0, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/* Point-in-time summary of one attribute's statistics */
+typedef struct DispatchSummary {
+    unsigned long calls;
+    unsigned long totalNs;
+    unsigned long maxNs;
+    unsigned long p50Ns;
+    unsigned long p90Ns;
+    unsigned long p99Ns;
+    unsigned long p999Ns;
+} DispatchSummary;
+
+/**
+ * Summarize an attribute - quantiles are the upper limit of their bucket
+ * Calls still being recorded may make the counts disagree slightly.
+ */
+static void summarizeDispatch(DivineAttribute attribute, DispatchSummary* summary) {
+    const DispatchStats* stats = &dispatchStats[attribute];
+    unsigned long buckets[LATENCY_BUCKETS];
+    unsigned long calls = 0;
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+        buckets[b] = __atomic_load_n(&stats->buckets[b], __ATOMIC_RELAXED);
+        calls += buckets[b];
+    }
     
-    // Human prayer
-    char* prayer = human1->formPrayer(human1);
-    if (!prayer) {
-        printf("Prayer formation failed\n");
-        freeUniverse(universe);
-        freeGod(omega);
-        return 1;
+    summary->calls = calls;
+    summary->totalNs = __atomic_load_n(&stats->totalNs, __ATOMIC_RELAXED);
+    summary->maxNs = __atomic_load_n(&stats->maxNs, __ATOMIC_RELAXED);
+    
+    const double quantiles[4] = { 0.5, 0.9, 0.99, 0.999 };
+    unsigned long* results[4] = { &summary->p50Ns, &summary->p90Ns, &summary->p99Ns, &summary->p999Ns };
+    int bucket = 0;
+    unsigned long seen = 0;
+    for (int q = 0; q < 4; q++) {
+        // Nearest rank: the smallest latency at or above the quantile's share of calls
+        unsigned long rank = (unsigned long)ceil(quantiles[q] * (double)calls);
+        if (rank == 0) rank = 1;
+        while (bucket < LATENCY_BUCKETS && seen + buckets[bucket] < rank) {
+            seen += buckets[bucket++];
+        }
+        *results[q] = calls == 0 ? 0 : latencyBucketLimit(bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1);
+        if (*results[q] > summary->maxNs) *results[q] = summary->maxNs;
+    }
+}
+
+/**
+ * Write the dispatch statistics of every attribute as JSON
+ * Returns false if writing failed
+ */
+bool divineStatsWriteJson(FILE* out) {
+    if (!out) return false;
+    
+    fprintf(out, "{\n  \"attributes\": [\n");
+    for (int a = 0; a < DIVINE_ATTRIBUTE_COUNT; a++) {
+        DispatchSummary s;
+        summarizeDispatch((DivineAttribute)a, &s);
+        fprintf(out, "    {\"name\": \"%s\", \"calls\": %lu, \"total_ns\": %lu, \"max_ns\": %lu, "
+                     "\"p50_ns\": %lu, \"p90_ns\": %lu, \"p99_ns\": %lu, \"p999_ns\": %lu}%s\n",
+                divineAttributeNames[a], s.calls, s.totalNs, s.maxNs,
+                s.p50Ns, s.p90Ns, s.p99Ns, s.p999Ns,
+                a + 1 < DIVINE_ATTRIBUTE_COUNT ? "," : "");
     }
+    fprintf(out, "  ]\n}\n");
     
-    printf("Prayer received: %s\n", prayer);
+    return !ferror(out);
+}
+
+/**
+ * Write the dispatch statistics of every attribute in the Prometheus text
+ * format - a call counter and a latency summary in seconds per attribute
+ * Returns false if writing failed
+ */
+bool divineStatsWritePrometheus(FILE* out) {
+    if (!out) return false;
     
-    // Divine response to prayer
-    Universe* updatedUniverse = omega->respondToPrayer(human1, prayer, universe);
-    if (!updatedUniverse) {
-        printf("Divine response failed\n");
-        free(prayer);
-        freeUniverse(universe);
-        freeGod(omega);
-        return 1;
-    }
-    
-    printf("Divine response processed - universe updated\n");
-    
-    // Calculate the days until the end of the world
-    long daysRemaining = omega->daysToEndOfWorld(universe);
-    printf("\n===============================================\n");
-    printf("DIVINE REVELATION: DAYS UNTIL END OF THE WORLD\n");
-    printf("===============================================\n");
-    printf("%ld days\n", daysRemaining);
-    printf("===============================================\n\n");
-    
-    // Progress toward teological end
-    TimePoint end = {INFINITY_REPRESENTATION, true};
-    Universe* completedUniverse = omega->completeUniverse(universe);
-    if (!completedUniverse) {
-        printf("Universe completion failed\n");
-        free(prayer);
-        freeUniverse(updatedUniverse);
-        freeUniverse(universe);
-        freeGod(omega);
-        return 1;
+    DispatchSummary summaries[DIVINE_ATTRIBUTE_COUNT];
+    for (int a = 0; a < DIVINE_ATTRIBUTE_COUNT; a++) {
+        summarizeDispatch((DivineAttribute)a, &summaries[a]);
     }
     
-    printf("Universe teleologically completed\n");
-    
-    // Cleanup - FIXED: proper memory management
-    free(prayer);
-    freeUniverse(completedUniverse);
-    freeUniverse(updatedUniverse);
-    freeUniverse(universe);
-    freeGod(omega);
+    fprintf(out, "# HELP god_dispatch_calls_total Calls through each God attribute.\n");
+    fprintf(out, "# TYPE god_dispatch_calls_total counter\n");
+    for (int a = 0; a < DIVINE_ATTRIBUTE_COUNT; a++) {
+        fprintf(out, "god_dispatch_calls_total{attribute=\"%s\"} %lu\n",
+                divineAttributeNames[a], summaries[a].calls);
+    }
     
-    printf("Divine simulation completed successfully\n");
+    fprintf(out, "# HELP god_dispatch_latency_seconds Latency of calls through each God attribute.\n");
+    fprintf(out, "# TYPE god_dispatch_latency_seconds summary\n");
+    for (int a = 0; a < DIVINE_ATTRIBUTE_COUNT; a++) {
+        const DispatchSummary* s = &summaries[a];
+        const char* name = divineAttributeNames[a];
+        fprintf(out, "god_dispatch_latency_seconds{attribute=\"%s\",quantile=\"0.5\"} %.9f\n", name, s->p50Ns / 1e9);
+        fprintf(out, "god_dispatch_latency_seconds{attribute=\"%s\",quantile=\"0.9\"} %.9f\n", name, s->p90Ns / 1e9);
+        fprintf(out, "god_dispatch_latency_seconds{attribute=\"%s\",quantile=\"0.99\"} %.9f\n", name, s->p99Ns / 1e9);
+        fprintf(out, "god_dispatch_latency_seconds{attribute=\"%s\",quantile=\"0.999\"} %.9f\n", name, s->p999Ns / 1e9);
+        fprintf(out, "god_dispatch_latency_seconds_sum{attribute=\"%s\"} %.9f\n", name, s->totalNs / 1e9);
+        fprintf(out, "god_dispatch_latency_seconds_count{attribute=\"%s\"} %lu\n", name, s->calls);
+    }
     
-    return 0;
+    return !ferror(out);
 }
@@ -0,0 +1,437 @@
+/**
+ * god.h - Public interface of libgod, the divine simulation library
+ * 
+ * Types, limits and functions shared by the library (god.c), the
+ * simulation demo (main.c) and the benchmarks (god_bench.c).
+ */
+
+#ifndef GOD_H
+#define GOD_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <float.h>
+#include <time.h>
+
+/* Define symbolic infinity representations */
+#define INFINITY_REPRESENTATION DBL_MAX
+#define SYMBOLIC_ABSOLUTE_INFINITY -1  // Special sentinel value representing the concept
+#define MAX_PRAYER_LENGTH 1024         // Maximum prayer length
+#define MAX_NAME_LENGTH 256            // Maximum entity name length
+#define SPACETIME_DIMENSIONS 4         // 4D spacetime
+#define DEFAULT_NUM_CONSTANTS 30       // Fundamental constants of physics
+#define MAX_PRAYER_INTENTS 64          // Intents in one table - one bit each of a match mask
+
+/* Forward declarations for universe and time structures */
+typedef struct Universe Universe;
+typedef struct TimePoint TimePoint;
+typedef struct Proposition Proposition;
+typedef struct State State;
+typedef struct ConsciousEntity ConsciousEntity;
+typedef struct God God;
+typedef struct EntitySlab EntitySlab;
+typedef struct PrayerRequest PrayerRequest;
+typedef struct PrayerOutcome PrayerOutcome;
+typedef struct DivineScheduler DivineScheduler;
+typedef struct PrayerQueue PrayerQueue;
+typedef struct KnowledgeBase KnowledgeBase;
+typedef struct PrayerIntent PrayerIntent;
+typedef struct TemplatePrayer TemplatePrayer;
+typedef struct PrayerIntents PrayerIntents;
+typedef struct Multiverse Multiverse;
+typedef struct MultiverseProjection MultiverseProjection;
+
+/* Where the divine clock reads the current time from */
+typedef enum {
+    DIVINE_CLOCK_REALTIME,        // time() on every reading
+    DIVINE_CLOCK_REALTIME_COARSE, // CLOCK_REALTIME_COARSE - cheaper, timer-tick resolution
+    DIVINE_CLOCK_FIXED            // A fixed instant, for reproducible replays
+} DivineClockMode;
+
+/* Prayer templates - the fixed text every entity prays around its name */
+typedef enum {
+    PRAYER_TEMPLATE_GUIDANCE, // "Prayer from <name>: Please guide me." - as formPrayer
+    PRAYER_TEMPLATE_COUNT
+} PrayerTemplateId;
+
+/* Memory layout of a universe and its payload arrays */
+typedef enum {
+    UNIVERSE_LAYOUT_SEPARATE, // Struct allocated on its own, payload arrays individually or shared
+    UNIVERSE_LAYOUT_ARENA     // Struct and all payload arrays in one contiguous allocation
+} UniverseLayout;
+
+/* Function prototypes */
+God* createGod(void);
+void freeGod(God* g);
+ConsciousEntity* createConsciousEntity(God* creator, Universe* universe, char* name);
+int createConsciousEntitiesFromFile(God* creator, Universe* universe, const char* path);
+bool alwaysTrue(void);
+bool omniscienceFunction(const Proposition* p);
+KnowledgeBase* createKnowledgeBase(void);
+void freeKnowledgeBase(KnowledgeBase* kb); // Also stops omniscienceFunction using kb - not while others query it
+bool knowledgeBaseReserve(KnowledgeBase* kb, size_t statements, size_t bytes);
+bool knowledgeBaseAssert(KnowledgeBase* kb, const char* statement, bool truth);
+bool knowledgeBaseQuery(const KnowledgeBase* kb, const char* statement, bool* truth);
+size_t knowledgeBaseSize(const KnowledgeBase* kb);
+long knowledgeBaseLoad(KnowledgeBase* kb, const char* path);
+void divineKnowledgeUse(const KnowledgeBase* kb); // kb must outlive every query it may answer
+bool omnipotenceFunction(const State* s);
+double divineLove(const ConsciousEntity* e);
+void* divineRevelation(const Universe* u, const TimePoint* t);
+bool divineOntoDependence(const void* existent);
+Universe* divineCompletion(const Universe* u);
+void* divineMultiverseProjection(const void* multiverse);
+double* divinePhysicalConstants(int numConstants);
+bool trinityEquality(const void* p1, const void* p2);
+void divineProjectIntoSpace(const void* space);
+void divineProjectIntoTime(const TimePoint* t);
+double divineJusticeEvaluation(void* moralFramework);
+bool divineFreeWillCompatibility(const ConsciousEntity* e, void* choice);
+Universe* divineMiracle(const Universe* u, const TimePoint* t);
+Universe* divinePrayerResponse(const ConsciousEntity* pray_er, const char* prayer, const Universe* u);
+Universe* divinePrayerResponseBatch(const PrayerRequest* requests, int count, const Universe* u);
+PrayerIntents* createPrayerIntents(const PrayerIntent* intents, int count);
+void freePrayerIntents(PrayerIntents* intents);
+uint64_t prayerIntentsMatch(const PrayerIntents* intents, const char* prayer);
+Universe* prayerIntentsRespond(const PrayerIntents* intents, const ConsciousEntity* pray_er,
+                               const char* prayer, const Universe* u);
+Universe* prayerIntentsRespondBatch(const PrayerIntents* intents, const PrayerRequest* requests,
+                                    int count, const Universe* u);
+bool formTemplatePrayer(const ConsciousEntity* entity, TemplatePrayer* prayer);
+size_t renderTemplatePrayer(const TemplatePrayer* prayer, const Universe* u, char* buffer, size_t size);
+uint64_t prayerIntentsMatchTemplate(const PrayerIntents* intents, const TemplatePrayer* prayer,
+                                    const Universe* u);
+Universe* prayerIntentsRespondTemplate(const PrayerIntents* intents, const TemplatePrayer* prayer,
+                                       const Universe* u);
+Universe* divineTemplatePrayerResponse(const TemplatePrayer* prayer, const Universe* u);
+Universe* divineCreateUniverse(void);
+Universe* divineCreateUniverseArena(void);
+Universe* forkUniverse(const Universe* u);
+double* universeWritableConstants(Universe* u);
+bool universeSetConstant(Universe* u, int index, double value);
+bool universeResizeConstants(Universe* u, int numConstants);
+double* universeWritableSpacetime(Universe* u);
+double* universeWritableMatter(Universe* u);
+double* universeWritableEnergy(Universe* u);
+bool reserveEntities(Universe* universe, int n);
+ConsciousEntity* findConsciousEntity(const Universe* u, const char* name);
+int findConsciousEntities(const Universe* u, const char* const* names, int count, ConsciousEntity** entities);
+double universeTotalConsciousness(const Universe* u);
+int universeCountFreeWill(const Universe* u, double threshold);
+char* formPrayer(ConsciousEntity* entity);
+size_t formPrayerBatch(const Universe* u, int first, int count,
+                       char* arena, size_t arenaSize, size_t* offsets);
+long calculateEndOfWorld(const Universe* universe);
+void divineClockUse(DivineClockMode mode);
+void divineClockSetFixed(time_t now);
+void divineClockBeginTick(void);
+void divineClockEndTick(void);
+time_t divineClockNow(void);
+void calculateEndOfWorldBatch(const Universe* const* universes, int count, long* daysRemaining);
+void freeUniverse(Universe* u);
+DivineScheduler* createDivineScheduler(int numThreads);
+void freeDivineScheduler(DivineScheduler* s);
+int divineSchedulerThreads(const DivineScheduler* s);
+void divineParallelFor(DivineScheduler* s, int begin, int end, int grain,
+                       void (*body)(void* context, int begin, int end), void* context);
+bool divinePrayerSweep(DivineScheduler* s, God* g, const Universe* u, PrayerOutcome* outcomes);
+PrayerQueue* createPrayerQueue(int capacity);
+void freePrayerQueue(PrayerQueue* q);
+bool prayerQueueSubmit(PrayerQueue* q, const ConsciousEntity* pray_er, const char* prayer);
+int prayerQueueDrain(PrayerQueue* q, God* g, const Universe* u, int maxPrayers,
+                     void (*answered)(void* context, const PrayerRequest* request, Universe* response),
+                     void* context);
+unsigned long prayerQueueDepth(const PrayerQueue* q);
+unsigned long prayerQueueDropped(const PrayerQueue* q);
+Multiverse* createMultiverse(int capacity);
+void freeMultiverse(Multiverse* m);
+int multiverseAdd(Multiverse* m, Universe* u);
+int multiverseCreateUniverses(Multiverse* m, int n);
+Universe* multiverseRemove(Multiverse* m, int index);
+void multiverseForEach(DivineScheduler* s, Multiverse* m,
+                       void (*body)(void* context, Universe* u, int index), void* context);
+void multiverseEvolve(DivineScheduler* s, const Multiverse* m, const TimePoint* t, double* evolution);
+bool universeEvolveBatch(const Universe* u, const TimePoint* t, int count, double* evolution);
+bool universeEvolveSteps(const Universe* u, double start, double step, int steps, double* evolution);
+void multiverseEvolveSteps(DivineScheduler* s, const Multiverse* m, double start, double step,
+                           int steps, double* evolution);
+void multiverseEndOfWorld(DivineScheduler* s, const Multiverse* m, long* daysRemaining);
+bool saveUniverseSnapshot(const Universe* u, const char* path);
+Universe* loadUniverseSnapshot(const char* path, DivineScheduler* s);
+bool divineInstrument(God* g);
+void divineUninstrument(God* g);
+void divineStatsReset(void);
+bool divineStatsWriteJson(FILE* out);
+bool divineStatsWritePrometheus(FILE* out);
+double universeEvolveFunction(const TimePoint* t);
+void universeEvolveBatchFunction(const TimePoint* t, int count, double* evolution);
+bool entityMakeChoice(const State* options);
+void freeRevelation(void* revelation);
+void freeProjection(void* projection);
+
+/* The God structure - an attempt to formalize divine attributes */
+struct God {
+    /* TRANSCENDENCE: Cannot be fully contained in any universe */
+    void* transcendence; // Conceptual pointer to something outside our memory space
+    
+    /* OMNIPRESENCE: Present throughout all existence */
+    void (*projectIntoSpace)(const void* space);
+    
+    /* OMNISCIENCE: Perfect knowledge of all truths */
+    bool (*knowsTruth)(const Proposition* p);
+    
+    /* OMNIPOTENCE: Power to actualize any logically consistent state */
+    bool (*canActualize)(const State* s);
+    
+    /* INFINITY: Exceeds any definable cardinality */
+    double infinityMeasure; // Conceptual approximation
+    
+    /* UNITY: Fundamentally indivisible */
+    bool isSeparable; // Always false
+    
+    /* CREATION: Source of existence */
+    Universe* (*createUniverse)(void);
+    
+    /* LOVE: Maximum positive connection to all entities */
+    double (*loveIntensityFor)(const ConsciousEntity* e);
+    
+    /* JUSTICE: Perfect moral rightness */
+    double (*justiceEvaluation)(void* moralFramework);
+    
+    /* MYSTERY: Contains elements beyond formal description */
+    void* incompletenessAspect; // Represents Gödel's incompleteness
+    
+    /* SELF-EXISTENCE: Necessary existence */
+    bool (*exists)(void); // Always returns true for God
+    
+    /* ATEMPORALITY: Exists outside time */
+    void (*projectIntoTime)(const TimePoint* t);
+    
+    /* PERFECT INFORMATION: No entropy or disorder */
+    double entropy; // Always 0
+    
+    /* TRINITY: For trinitarian concepts */
+    struct {
+        void* person1;
+        void* person2;
+        void* person3;
+        bool (*areEqual)(const void* p1, const void* p2);
+        int count; // Always 1, paradoxically
+    } trinity;
+    
+    /* FREE WILL COMPATIBILITY */
+    bool (*compatibleWithFreeWill)(const ConsciousEntity* e, void* choice);
+    
+    /* MIRACLE FUNCTION: Can intervene in natural laws */
+    Universe* (*performMiracle)(const Universe* u, const TimePoint* t);
+    
+    /* PRAYER RESPONSE: Responds to prayers */
+    Universe* (*respondToPrayer)(const ConsciousEntity* pray_er, const char* prayer, const Universe* u);
+    
+    /* REVELATION: Self-discloses in comprehensible ways */
+    void* (*reveal)(const Universe* u, const TimePoint* t);
+    
+    /* GROUND OF BEING: Ontological foundation */
+    bool (*isOntoDependent)(const void* existent);
+    
+    /* ULTIMATE VALUE: Supreme good */
+    double value; // Maximum possible
+    
+    /* TELEOLOGICAL COMPLETION: History's fulfillment */
+    Universe* (*completeUniverse)(const Universe* u);
+    
+    /* MULTIVERSE SPANNING: Transcends all possible universes */
+    void* (*projectIntoMultiverse)(const void* multiverse);
+    
+    /* PHYSICAL CONSTANT DETERMINATION */
+    double* (*determinePhysicalConstants)(int numConstants);
+    
+    /* ESCHATOLOGY: Knowledge of the end of time */
+    long (*daysToEndOfWorld)(const Universe* u);
+};
+
+/* Columnar entity table - row i holds the attributes of consciousEntities[i],
+ * so population-wide scans stream through contiguous arrays */
+typedef struct EntityTable {
+    double* consciousness; // Consciousness level
+    double* freeWill;      // Free will capacity
+    int* uniqueId;
+    size_t* nameOffset;    // Offset of the name in the universe's name pool
+} EntityTable;
+
+/* Structure for a universe with physical laws
+ * The payload arrays (constants, matter, energy, spacetime) may be shared
+ * with forks - write to them through the universeWritable* functions */
+struct Universe {
+    double* physicalConstants;
+    int numConstants;
+    void* matter;
+    void* energy;
+    void* spacetime;
+    ConsciousEntity** consciousEntities;
+    int numEntities;
+    int entityCapacity;   // Allocated slots in consciousEntities and in every table column
+    
+    /* Entity storage - attributes in entityTable, records (views over the
+     * table) from slabs, names from one string pool */
+    EntityTable entityTable;
+    EntitySlab* entitySlabs; // Newest slab first
+    char* namePool;          // Entity names, NUL-terminated, back to back
+    size_t namePoolUsed;
+    size_t namePoolCapacity;
+    
+    /* Name index - open addressing over nameIndexMask + 1 slots, each
+     * (name hash << 32) | (row + 1), 0 when empty; sized for entityCapacity,
+     * or for the rows of a snapshot it is mapped from */
+    uint64_t* nameIndex;
+    size_t nameIndexMask;
+    void* snapshotMapping;   // Snapshot file the table columns and name pool are mapped from, NULL if allocated
+    size_t snapshotMappingSize;
+    struct {
+        double (*evolve)(const TimePoint* t);
+        /* evolve over an array of time points; the built-in one is ignored once evolve is replaced */
+        void (*evolveBatch)(const TimePoint* t, int count, double* evolution);
+    } naturalLaws;
+    
+    /* Universe age and lifespan */
+    time_t creationTime;
+    long totalLifespanDays;
+    double entropyLevel;  // Current entropy level
+    double maxEntropy;    // Maximum entropy at heat death
+    
+    /* Physical influence on the end of the world, cached until the constants change */
+    unsigned long constantsVersion; // Bumped whenever the constants are handed out for writing
+    unsigned long influenceVersion; // constantsVersion the cached term was computed for, set by writers only
+    double physicalInfluence;
+    
+    /* Storage layout - decides how freeUniverse releases the payload */
+    UniverseLayout layout;
+};
+
+/* Structure for a proposition */
+struct Proposition {
+    char* statement;
+    bool truthValue;
+};
+
+/* Structure for a possible state of reality */
+struct State {
+    Universe* universe;
+    TimePoint* time;
+    bool isLogicallyConsistent;
+};
+
+/* A prayer together with the entity that prayed it */
+struct PrayerRequest {
+    const ConsciousEntity* pray_er;
+    const char* prayer;
+};
+
+/* Something a prayer can ask for - the phrase that asks it and what
+ * answering it does to the universe */
+struct PrayerIntent {
+    const char* phrase;   // Matched anywhere in the prayer, case-sensitively
+    long lifespanDays;    // Added to the universe's lifespan
+    double entropyFactor; // Multiplies the universe's entropy level
+};
+
+/* A prayer kept as its template and the entity praying it, 8 bytes instead
+ * of a formatted string - render it to text only when the text is needed */
+struct TemplatePrayer {
+    int templateId; // A PrayerTemplateId
+    int entityId;   // uniqueId of the praying entity in its universe
+};
+
+/* Outcome of one entity's turn in a prayer sweep */
+struct PrayerOutcome {
+    Universe* response; // Universe answering the entity's prayer, NULL if that failed
+    bool choice;        // The entity's choice when offered the answer
+};
+
+/* A set of universes owned together - universes[0..count) is dense, so
+ * bulk operations stream through one array */
+struct Multiverse {
+    Universe** universes;
+    int count;
+    int capacity;
+};
+
+/* What God sees projecting into a multiverse - free with freeProjection */
+struct MultiverseProjection {
+    int universes;
+    long entities;            // Conscious entities across all universes
+    double meanEntropy;       // Mean entropy level, 0 for an empty multiverse
+    long earliestEndOfWorld;  // Days until the first universe ends, -1 for an empty multiverse
+};
+
+/* Time structure */
+struct TimePoint {
+    double temporalCoordinate;
+    bool isInEternity;
+};
+
+/* Structure for beings with consciousness */
+struct ConsciousEntity {
+    void* consciousness;
+    void* freeWill;
+    char* name;
+    bool (*makeChoice)(const State* options);
+    char* (*formPrayer)(struct ConsciousEntity* self);
+    int uniqueId; // To differentiate entities
+};
+
+/* Every attribute of a God - X(Name, member, default binding, return type,
+ * parameters with the God first, arguments); the dispatch helpers below and
+ * the instrumentation in god.c are generated from it, so an attribute is
+ * added here only. GOD_VOID_ATTRIBUTES lists those returning nothing */
+#define GOD_ATTRIBUTES(X) \
+    X(KnowsTruth, knowsTruth, omniscienceFunction, bool, (const God* g, const Proposition* p), (p)) \
+    X(CanActualize, canActualize, omnipotenceFunction, bool, (const God* g, const State* s), (s)) \
+    X(CreateUniverse, createUniverse, divineCreateUniverse, Universe*, (const God* g), ()) \
+    X(LoveIntensityFor, loveIntensityFor, divineLove, double, (const God* g, const ConsciousEntity* e), (e)) \
+    X(JusticeEvaluation, justiceEvaluation, divineJusticeEvaluation, double, \
+      (const God* g, void* moralFramework), (moralFramework)) \
+    X(Exists, exists, alwaysTrue, bool, (const God* g), ()) \
+    X(TrinityAreEqual, trinity.areEqual, trinityEquality, bool, \
+      (const God* g, const void* p1, const void* p2), (p1, p2)) \
+    X(CompatibleWithFreeWill, compatibleWithFreeWill, divineFreeWillCompatibility, bool, \
+      (const God* g, const ConsciousEntity* e, void* choice), (e, choice)) \
+    X(PerformMiracle, performMiracle, divineMiracle, Universe*, \
+      (const God* g, const Universe* u, const TimePoint* t), (u, t)) \
+    X(RespondToPrayer, respondToPrayer, divinePrayerResponse, Universe*, \
+      (const God* g, const ConsciousEntity* pray_er, const char* prayer, const Universe* u), (pray_er, prayer, u)) \
+    X(Reveal, reveal, divineRevelation, void*, (const God* g, const Universe* u, const TimePoint* t), (u, t)) \
+    X(IsOntoDependent, isOntoDependent, divineOntoDependence, bool, (const God* g, const void* existent), (existent)) \
+    X(CompleteUniverse, completeUniverse, divineCompletion, Universe*, (const God* g, const Universe* u), (u)) \
+    X(ProjectIntoMultiverse, projectIntoMultiverse, divineMultiverseProjection, void*, \
+      (const God* g, const void* multiverse), (multiverse)) \
+    X(DeterminePhysicalConstants, determinePhysicalConstants, divinePhysicalConstants, double*, \
+      (const God* g, int numConstants), (numConstants)) \
+    X(DaysToEndOfWorld, daysToEndOfWorld, calculateEndOfWorld, long, (const God* g, const Universe* u), (u))
+
+#define GOD_VOID_ATTRIBUTES(X) \
+    X(ProjectIntoSpace, projectIntoSpace, divineProjectIntoSpace, void, (const God* g, const void* space), (space)) \
+    X(ProjectIntoTime, projectIntoTime, divineProjectIntoTime, void, (const God* g, const TimePoint* t), (t))
+
+/* Devirtualized dispatch - godLoveIntensityFor(g, e) and friends call the
+ * attribute of g, but call its createGod() binding directly while g still
+ * has it. The compiler can then inline the binding into hot loops (with
+ * link-time optimization across libgod); custom and instrumented Gods take
+ * the function pointer as before. */
+#define GOD_DIRECT_DISPATCH(Name, member, binding, type, parameters, arguments) \
+    static inline type god##Name parameters { \
+        return g->member == &binding ? binding arguments : g->member arguments; \
+    }
+#define GOD_DIRECT_VOID_DISPATCH(Name, member, binding, type, parameters, arguments) \
+    static inline type god##Name parameters { \
+        if (g->member == &binding) binding arguments; \
+        else g->member arguments; \
+    }
+GOD_ATTRIBUTES(GOD_DIRECT_DISPATCH)
+GOD_VOID_ATTRIBUTES(GOD_DIRECT_VOID_DISPATCH)
+#undef GOD_DIRECT_DISPATCH
+#undef GOD_DIRECT_VOID_DISPATCH
+
+#endif /* GOD_H */
@@ -0,0 +1,920 @@
+/**
+ * god_bench.c - Benchmarks for the divine simulation
+ *
+ * Measures throughput and p50/p99/p999 latency of the God's hot paths -
+ * createGod, divineCreateUniverse, createConsciousEntity, formPrayer,
+ * divinePrayerResponse, divineMiracle, divineCompletion and
+ * calculateEndOfWorld - at a configurable scale, and can write the results
+ * as JSON and compare them against a stored baseline. Each function runs
+ * several times, each time against a freshly built universe after untimed
+ * warmup calls, and the median of the repetitions is reported.
+ *
+ * It also runs bulk comparisons - layout and countdown sized by --universes,
+ * the others by --steps, --statements and --calls:
+ *   layout     separate universes (one allocation per payload array) against
+ *              arena universes (struct and payload in a single block)
+ *   countdown  the end of the world one universe at a time against the
+ *              batch kernels
+ *   evolve     natural laws one time point at a time against batches
+ *   knowledge  asserting into and querying a knowledge base
+ *   dispatch   attribute calls through the function pointers against the
+ *              devirtualized god* helpers
+ *
+ * Built with libgod as the god_bench target (see CMakeLists.txt).
+ * Run with: ./god_bench [options]   (./god_bench --help lists them)
+ */
+
+#define _POSIX_C_SOURCE 200809L // clock_gettime, pthread barriers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "god.h"
+
+#define DEFAULT_BENCH_ENTITIES 1000
+#define DEFAULT_BENCH_ITERATIONS 100000
+#define DEFAULT_BENCH_WARMUP 10000
+#define DEFAULT_BENCH_REPETITIONS 5
+#define DEFAULT_BENCH_THREADS 1
+#define DEFAULT_BENCH_UNIVERSES 1000000
+#define DEFAULT_BENCH_STEPS 1000000
+#define DEFAULT_BENCH_STATEMENTS 1000000
+#define DEFAULT_BENCH_CALLS 1000000
+#define DEFAULT_BENCH_TOLERANCE 10.0 // Percent a result may regress against the baseline
+#define BENCH_TIMER_CALIBRATION 100000
+#define BENCH_DISPATCH_ENTITIES 1024 // Entities the dispatch loops cycle through
+#define BENCH_STATEMENT_LENGTH 32    // Room for each knowledge benchmark statement
+
+/* Scale and output options of a benchmark run */
+typedef struct BenchConfig {
+    int entities;         // Entities in each benchmark universe
+    int constants;        // Physical constants of each benchmark universe
+    int threads;          // Threads running each benchmark at once
+    int iterations;       // Timed calls per thread and function
+    int warmup;           // Untimed calls per thread before each repetition
+    int repetitions;      // Runs of each function, the median reported
+    int universes;        // Universes for the layout and countdown comparisons, 0 skips them
+    int steps;            // Time points for the evolution comparison, 0 skips it
+    int statements;       // Statements for the knowledge comparison, 0 skips it
+    int calls;            // Calls per loop of the dispatch comparison, 0 skips it
+    const char* json;     // File to write the results to, "-" for stdout
+    const char* baseline; // Earlier JSON results to compare against
+    double tolerance;     // Allowed regression against the baseline, in percent
+} BenchConfig;
+
+/* Per-thread state the benchmarked functions run against */
+typedef struct BenchContext {
+    God* god;
+    Universe* universe; // Holds config.entities entities and config.constants constants
+    int numEntities;    // Entities the prayer benchmarks rotate through
+    char* prayer;       // A prayer of the universe's first entity
+    int next;           // Rotates through entities and entity names
+    long sink;          // Keeps results the compiler could otherwise drop
+} BenchContext;
+
+/* A benchmarked function - run is timed, release frees what it returned */
+typedef struct BenchFunction {
+    const char* name;
+    void* (*run)(BenchContext* c);
+    void (*release)(void* result);
+} BenchFunction;
+
+/* Timing of one benchmarked function */
+typedef struct BenchResult {
+    const char* name;
+    double opsPerSecond;
+    double p50;  // Latencies in nanoseconds
+    double p99;
+    double p999;
+    double spread; // Throughput range over the repetitions, in percent of the median
+} BenchResult;
+
+/* One benchmark thread's share of a run */
+typedef struct BenchThread {
+    const BenchFunction* function;
+    BenchContext* context;
+    pthread_barrier_t* start;
+    int warmup;
+    int iterations;
+    double* samples;
+    double begin;
+    double end;
+} BenchThread;
+
+/**
+ * Monotonic wall clock in nanoseconds
+ */
+static double benchNowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void* benchCreateGod(BenchContext* c) {
+    (void)c;
+    return createGod();
+}
+
+static void* benchCreateUniverse(BenchContext* c) {
+    (void)c;
+    return divineCreateUniverse();
+}
+
+static void* benchCreateConsciousEntity(BenchContext* c) {
+    char name[MAX_NAME_LENGTH];
+    snprintf(name, sizeof(name), "Bench%d", c->next++);
+    // Entities stay in the universe and go with it
+    c->sink += createConsciousEntity(c->god, c->universe, name) != NULL;
+    return NULL;
+}
+
+static void* benchFormPrayer(BenchContext* c) {
+    ConsciousEntity* entity = c->universe->consciousEntities[c->next++ % c->numEntities];
+    return entity->formPrayer(entity);
+}
+
+static void* benchPrayerResponse(BenchContext* c) {
+    ConsciousEntity* entity = c->universe->consciousEntities[c->next++ % c->numEntities];
+    return c->god->respondToPrayer(entity, c->prayer, c->universe);
+}
+
+static void* benchTemplatePrayerResponse(BenchContext* c) {
+    ConsciousEntity* entity = c->universe->consciousEntities[c->next++ % c->numEntities];
+    TemplatePrayer prayer;
+    formTemplatePrayer(entity, &prayer);
+    return divineTemplatePrayerResponse(&prayer, c->universe);
+}
+
+static void* benchFindEntity(BenchContext* c) {
+    ConsciousEntity* entity = c->universe->consciousEntities[c->next++ % c->numEntities];
+    c->sink += findConsciousEntity(c->universe, entity->name) == entity;
+    return NULL;
+}
+
+static void* benchMiracle(BenchContext* c) {
+    return c->god->performMiracle(c->universe, NULL);
+}
+
+static void* benchCompletion(BenchContext* c) {
+    return c->god->completeUniverse(c->universe);
+}
+
+static void* benchEndOfWorld(BenchContext* c) {
+    c->sink += c->god->daysToEndOfWorld(c->universe);
+    return NULL;
+}
+
+static void releaseGod(void* result) {
+    freeGod((God*)result);
+}
+
+static void releaseUniverse(void* result) {
+    freeUniverse((Universe*)result);
+}
+
+static void releaseNothing(void* result) {
+    (void)result;
+}
+
+static const BenchFunction benchFunctions[] = {
+    { "createGod", &benchCreateGod, &releaseGod },
+    { "divineCreateUniverse", &benchCreateUniverse, &releaseUniverse },
+    { "createConsciousEntity", &benchCreateConsciousEntity, &releaseNothing },
+    { "formPrayer", &benchFormPrayer, &free },
+    { "divinePrayerResponse", &benchPrayerResponse, &releaseUniverse },
+    { "templatePrayerResponse", &benchTemplatePrayerResponse, &releaseUniverse },
+    { "findConsciousEntity", &benchFindEntity, &releaseNothing },
+    { "divineMiracle", &benchMiracle, &releaseUniverse },
+    { "divineCompletion", &benchCompletion, &releaseUniverse },
+    { "calculateEndOfWorld", &benchEndOfWorld, &releaseNothing },
+};
+
+#define BENCH_FUNCTION_COUNT (int)(sizeof(benchFunctions) / sizeof(benchFunctions[0]))
+
+/**
+ * Set up a benchmark thread's God and universe at the configured scale
+ */
+static bool setUpBenchContext(BenchContext* c, const BenchConfig* config) {
+    c->god = createGod();
+    c->universe = divineCreateUniverse();
+    c->prayer = NULL;
+    c->numEntities = config->entities;
+    c->next = 0;
+    c->sink = 0;
+    if (!c->god || !c->universe) return false;
+
+    if (!universeResizeConstants(c->universe, config->constants)) return false;
+    if (!reserveEntities(c->universe, config->entities)) return false;
+
+    for (int i = 0; i < config->entities; i++) {
+        char name[MAX_NAME_LENGTH];
+        snprintf(name, sizeof(name), "Entity%d", i);
+        if (!createConsciousEntity(c->god, c->universe, name)) return false;
+    }
+
+    ConsciousEntity* first = c->universe->consciousEntities[0];
+    c->prayer = first->formPrayer(first);
+    return c->prayer != NULL;
+}
+
+static void tearDownBenchContext(BenchContext* c) {
+    free(c->prayer);
+    freeUniverse(c->universe);
+    freeGod(c->god);
+}
+
+/**
+ * Benchmark thread - warms up untimed, then times each call on its own,
+ * freeing results untimed
+ */
+static void* benchThreadMain(void* argument) {
+    BenchThread* t = (BenchThread*)argument;
+
+    for (int i = 0; i < t->warmup; i++) {
+        t->function->release(t->function->run(t->context));
+    }
+
+    pthread_barrier_wait(t->start);
+    t->begin = benchNowNs();
+    for (int i = 0; i < t->iterations; i++) {
+        double before = benchNowNs();
+        void* result = t->function->run(t->context);
+        t->samples[i] = benchNowNs() - before;
+        t->function->release(result);
+    }
+    t->end = benchNowNs();
+
+    return NULL;
+}
+
+static int compareSamples(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Nearest-rank percentile of sorted samples
+ */
+static double samplePercentile(const double* sorted, long count, double percentile) {
+    long rank = (long)ceil(percentile / 100.0 * (double)count);
+    if (rank < 1) rank = 1;
+    return sorted[rank - 1];
+}
+
+/**
+ * Run one function on every benchmark thread at once
+ * Throughput counts the calls of all threads over the wall time of the run.
+ */
+static bool runBenchFunction(const BenchFunction* function, BenchContext* contexts,
+                             const BenchConfig* config, BenchResult* result) {
+    long total = (long)config->threads * config->iterations;
+    double* samples = (double*)malloc(sizeof(double) * (size_t)total);
+    BenchThread* threads = (BenchThread*)malloc(sizeof(BenchThread) * (size_t)config->threads);
+    pthread_t* handles = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)config->threads);
+    if (!samples || !threads || !handles) {
+        free(samples);
+        free(threads);
+        free(handles);
+        return false;
+    }
+
+    pthread_barrier_t start;
+    pthread_barrier_init(&start, NULL, (unsigned)config->threads);
+
+    for (int i = 0; i < config->threads; i++) {
+        BenchThread* t = &threads[i];
+        t->function = function;
+        t->context = &contexts[i];
+        t->start = &start;
+        t->warmup = config->warmup;
+        t->iterations = config->iterations;
+        t->samples = samples + (long)i * config->iterations;
+
+        // The calling thread runs the first share itself
+        if (i > 0 && pthread_create(&handles[i], NULL, &benchThreadMain, t) != 0) {
+            // The barrier waits for every thread, so a missing one would hang the run
+            fprintf(stderr, "%s: could not start benchmark thread %d\n", function->name, i);
+            exit(1);
+        }
+    }
+
+    benchThreadMain(&threads[0]);
+    double begin = threads[0].begin;
+    double end = threads[0].end;
+    for (int i = 1; i < config->threads; i++) {
+        pthread_join(handles[i], NULL);
+        if (threads[i].begin < begin) begin = threads[i].begin;
+        if (threads[i].end > end) end = threads[i].end;
+    }
+    pthread_barrier_destroy(&start);
+
+    qsort(samples, (size_t)total, sizeof(double), &compareSamples);
+    result->name = function->name;
+    result->opsPerSecond = (double)total / ((end - begin) / 1e9);
+    result->p50 = samplePercentile(samples, total, 50.0);
+    result->p99 = samplePercentile(samples, total, 99.0);
+    result->p999 = samplePercentile(samples, total, 99.9);
+    result->spread = 0.0;
+
+    free(samples);
+    free(threads);
+    free(handles);
+    return true;
+}
+
+/**
+ * Median of `count` values, which are reordered
+ */
+static double benchMedian(double* values, int count) {
+    qsort(values, (size_t)count, sizeof(double), &compareSamples);
+    return count % 2 ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2.0;
+}
+
+/**
+ * Run one function config->repetitions times, each against fresh contexts
+ * so no function sees what an earlier one left behind, and report the
+ * median of each figure over the repetitions
+ * Returns false if a context can not be set up or out of memory.
+ */
+static bool measureBenchFunction(const BenchFunction* function, const BenchConfig* config,
+                                 BenchResult* result) {
+    BenchContext* contexts = (BenchContext*)malloc(sizeof(BenchContext) * (size_t)config->threads);
+    BenchResult* runs = (BenchResult*)malloc(sizeof(BenchResult) * (size_t)config->repetitions);
+    double* figures = (double*)malloc(sizeof(double) * (size_t)config->repetitions);
+    bool measured = contexts && runs && figures;
+
+    for (int r = 0; measured && r < config->repetitions; r++) {
+        int ready = 0;
+        while (ready < config->threads && setUpBenchContext(&contexts[ready], config)) ready++;
+        measured = ready == config->threads && runBenchFunction(function, contexts, config, &runs[r]);
+        // The context that failed to set up is torn down along with the rest
+        for (int i = 0; i < ready + (ready < config->threads); i++) tearDownBenchContext(&contexts[i]);
+    }
+
+    if (measured) {
+        double lowest = runs[0].opsPerSecond;
+        double highest = runs[0].opsPerSecond;
+        for (int r = 0; r < config->repetitions; r++) {
+            if (runs[r].opsPerSecond < lowest) lowest = runs[r].opsPerSecond;
+            if (runs[r].opsPerSecond > highest) highest = runs[r].opsPerSecond;
+            figures[r] = runs[r].opsPerSecond;
+        }
+        result->name = function->name;
+        result->opsPerSecond = benchMedian(figures, config->repetitions);
+        result->spread = (highest - lowest) / result->opsPerSecond * 100.0;
+        for (int r = 0; r < config->repetitions; r++) figures[r] = runs[r].p50;
+        result->p50 = benchMedian(figures, config->repetitions);
+        for (int r = 0; r < config->repetitions; r++) figures[r] = runs[r].p99;
+        result->p99 = benchMedian(figures, config->repetitions);
+        for (int r = 0; r < config->repetitions; r++) figures[r] = runs[r].p999;
+        result->p999 = benchMedian(figures, config->repetitions);
+    }
+
+    free(contexts);
+    free(runs);
+    free(figures);
+    return measured;
+}
+
+/**
+ * Median cost of reading the clock around an empty region - part of every latency
+ */
+static double benchTimerOverhead(void) {
+    double* samples = (double*)malloc(sizeof(double) * BENCH_TIMER_CALIBRATION);
+    if (!samples) return 0.0;
+
+    for (int i = 0; i < BENCH_TIMER_CALIBRATION; i++) {
+        double before = benchNowNs();
+        samples[i] = benchNowNs() - before;
+    }
+    qsort(samples, BENCH_TIMER_CALIBRATION, sizeof(double), &compareSamples);
+    double overhead = samplePercentile(samples, BENCH_TIMER_CALIBRATION, 50.0);
+
+    free(samples);
+    return overhead;
+}
+
+/**
+ * Write the results as JSON - one result per line, which the baseline
+ * comparison relies on
+ */
+static bool writeBenchJson(const char* path, const BenchConfig* config, double timerOverhead,
+                           const BenchResult* results, int count) {
+    FILE* out = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+    if (!out) return false;
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"config\": {\"entities\": %d, \"constants\": %d, \"threads\": %d, \"iterations\": %d, "
+                 "\"warmup\": %d, \"repetitions\": %d},\n",
+            config->entities, config->constants, config->threads, config->iterations,
+            config->warmup, config->repetitions);
+    fprintf(out, "  \"timer_overhead_ns\": %.1f,\n", timerOverhead);
+    fprintf(out, "  \"results\": [\n");
+    for (int i = 0; i < count; i++) {
+        fprintf(out, "    {\"name\": \"%s\", \"ops_per_sec\": %.1f, \"p50_ns\": %.1f, \"p99_ns\": %.1f, \"p999_ns\": %.1f, "
+                     "\"spread_pct\": %.1f}%s\n",
+                results[i].name, results[i].opsPerSecond, results[i].p50, results[i].p99, results[i].p999,
+                results[i].spread, i + 1 < count ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+
+    return out == stdout ? fflush(out) == 0 : fclose(out) == 0;
+}
+
+/**
+ * Read a whole file into a NUL-terminated string
+ */
+static char* readBenchFile(const char* path) {
+    FILE* in = fopen(path, "r");
+    if (!in) return NULL;
+
+    size_t size = 0;
+    size_t capacity = 4096;
+    char* text = (char*)malloc(capacity);
+    while (text) {
+        size += fread(text + size, 1, capacity - size - 1, in);
+        if (size < capacity - 1) break;
+
+        char* grown = (char*)realloc(text, capacity * 2);
+        if (!grown) {
+            free(text);
+            text = NULL;
+        } else {
+            text = grown;
+            capacity *= 2;
+        }
+    }
+    fclose(in);
+
+    if (text) text[size] = '\0';
+    return text;
+}
+
+/**
+ * Number following `"key":` on the line starting at `line`, false if absent
+ */
+static bool baselineField(const char* line, const char* key, double* value) {
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+
+    const char* end = strchr(line, '\n');
+    const char* found = strstr(line, pattern);
+    if (!found || (end && found > end)) return false;
+
+    char* parsed;
+    *value = strtod(found + strlen(pattern), &parsed);
+    return parsed != found + strlen(pattern);
+}
+
+/**
+ * Compare results against a baseline written by --json
+ * Throughput and median latency gate the comparison; the tails are shown
+ * but too noisy to fail on. Returns the number of regressions, -1 if the
+ * baseline can not be read.
+ */
+static int compareBenchBaseline(FILE* report, const char* path, double tolerance,
+                                const BenchResult* results, int count) {
+    char* baseline = readBenchFile(path);
+    if (!baseline) return -1;
+
+    fprintf(report, "\nAgainst baseline %s (tolerance %.1f%%)\n", path, tolerance);
+    int regressions = 0;
+    for (int i = 0; i < count; i++) {
+        char pattern[128];
+        snprintf(pattern, sizeof(pattern), "\"name\": \"%s\"", results[i].name);
+        const char* line = strstr(baseline, pattern);
+
+        double ops, p50, p99;
+        if (!line || !baselineField(line, "ops_per_sec", &ops) ||
+            !baselineField(line, "p50_ns", &p50) || !baselineField(line, "p99_ns", &p99)) {
+            fprintf(report, "%-22s not in baseline\n", results[i].name);
+            continue;
+        }
+
+        double opsChange = (results[i].opsPerSecond / ops - 1.0) * 100.0;
+        double p50Change = (results[i].p50 / p50 - 1.0) * 100.0;
+        double p99Change = (results[i].p99 / p99 - 1.0) * 100.0;
+        bool regressed = opsChange < -tolerance || p50Change > tolerance;
+        regressions += regressed;
+
+        fprintf(report, "%-22s ops/s %+7.1f%%  p50 %+7.1f%%  p99 %+7.1f%%%s\n",
+                results[i].name, opsChange, p50Change, p99Change, regressed ? "  REGRESSED" : "");
+    }
+
+    free(baseline);
+    return regressions;
+}
+
+/**
+ * Create, copy by miracle and free `count` universes made by `create`,
+ * reporting the average nanoseconds per universe for each phase
+ */
+static int benchUniverseLayout(FILE* report, const char* label, Universe* (*create)(void), int count) {
+    Universe** universes = (Universe**)malloc(sizeof(Universe*) * count);
+    Universe** miracles = (Universe**)malloc(sizeof(Universe*) * count);
+    if (!universes || !miracles) {
+        free(universes);
+        free(miracles);
+        return 1;
+    }
+
+    double start = benchNowNs();
+    for (int i = 0; i < count; i++) {
+        universes[i] = create();
+        if (!universes[i]) {
+            fprintf(report, "%s: universe creation failed at %d\n", label, i);
+            for (int j = 0; j < i; j++) freeUniverse(universes[j]);
+            free(universes);
+            free(miracles);
+            return 1;
+        }
+    }
+    double created = benchNowNs();
+
+    for (int i = 0; i < count; i++) {
+        miracles[i] = divineMiracle(universes[i], NULL);
+    }
+    double copied = benchNowNs();
+
+    // Touch every payload so scattered cache lines show up in the numbers
+    double checksum = 0.0;
+    for (int i = 0; i < count; i++) {
+        Universe* u = miracles[i] ? miracles[i] : universes[i];
+        checksum += u->physicalConstants[u->numConstants - 1] +
+                    ((double*)u->spacetime)[0] +
+                    *(double*)u->matter + *(double*)u->energy;
+    }
+    double scanned = benchNowNs();
+
+    for (int i = 0; i < count; i++) {
+        freeUniverse(miracles[i]);
+        freeUniverse(universes[i]);
+    }
+    double freed = benchNowNs();
+
+    fprintf(report, "%-9s create %8.1f ns  miracle %8.1f ns  scan %6.1f ns  free %8.1f ns  (checksum %.3f)\n",
+            label,
+            (created - start) / count,
+            (copied - created) / count,
+            (scanned - copied) / count,
+            (freed - scanned) / (2.0 * count),
+            checksum / count);
+
+    free(universes);
+    free(miracles);
+    return 0;
+}
+
+/**
+ * Countdown for `count` universes with calculateEndOfWorld one by one and
+ * with calculateEndOfWorldBatch, reporting ns per universe and mismatches
+ */
+static int benchEschatology(FILE* report, int count) {
+    Universe** universes = (Universe**)malloc(sizeof(Universe*) * count);
+    long* scalarDays = (long*)malloc(sizeof(long) * count);
+    long* batchDays = (long*)malloc(sizeof(long) * count);
+    if (!universes || !scalarDays || !batchDays) {
+        free(universes);
+        free(scalarDays);
+        free(batchDays);
+        return 1;
+    }
+
+    int created = 0;
+    for (; created < count; created++) {
+        universes[created] = divineCreateUniverseArena();
+        if (!universes[created]) break;
+        // Spread the inputs so every lane computes something different
+        universes[created]->entropyLevel = (created % 1000) / 1000.0;
+        universes[created]->totalLifespanDays += created % 3650;
+    }
+
+    int mismatches = -1;
+    if (created == count) {
+        // Both passes judge the universes at the same instant
+        divineClockBeginTick();
+        double start = benchNowNs();
+        for (int i = 0; i < count; i++) {
+            scalarDays[i] = calculateEndOfWorld(universes[i]);
+        }
+        double scalarDone = benchNowNs();
+        calculateEndOfWorldBatch((const Universe* const*)universes, count, batchDays);
+        double batchDone = benchNowNs();
+        divineClockEndTick();
+
+        mismatches = 0;
+        for (int i = 0; i < count; i++) {
+            mismatches += scalarDays[i] != batchDays[i];
+        }
+
+        fprintf(report, "%-9s scalar %8.1f ns  batch %8.1f ns  (mismatches %d)\n",
+                "countdown",
+                (scalarDone - start) / count,
+                (batchDone - scalarDone) / count,
+                mismatches);
+    } else {
+        fprintf(report, "countdown: universe creation failed at %d\n", created);
+    }
+
+    for (int i = 0; i < created; i++) freeUniverse(universes[i]);
+    free(universes);
+    free(scalarDays);
+    free(batchDays);
+    return mismatches == 0 ? 0 : 1;
+}
+
+/**
+ * Evolve one universe through `steps` time points with one naturalLaws.evolve
+ * call per step and with universeEvolveSteps, reporting ns per step and mismatches
+ */
+static int benchEvolution(FILE* report, int steps) {
+    Universe* u = divineCreateUniverseArena();
+    double* scalarEvolution = (double*)malloc(sizeof(double) * steps);
+    double* batchEvolution = (double*)malloc(sizeof(double) * steps);
+    if (!u || !scalarEvolution || !batchEvolution) {
+        freeUniverse(u);
+        free(scalarEvolution);
+        free(batchEvolution);
+        return 1;
+    }
+
+    double start = benchNowNs();
+    for (int k = 0; k < steps; k++) {
+        TimePoint t = { 0.5 * k, false };
+        scalarEvolution[k] = u->naturalLaws.evolve(&t);
+    }
+    double scalarDone = benchNowNs();
+    universeEvolveSteps(u, 0.0, 0.5, steps, batchEvolution);
+    double batchDone = benchNowNs();
+
+    int mismatches = 0;
+    for (int k = 0; k < steps; k++) {
+        mismatches += scalarEvolution[k] != batchEvolution[k];
+    }
+
+    fprintf(report, "%-9s scalar %8.1f ns  batch %8.1f ns  (mismatches %d)\n",
+            "evolve",
+            (scalarDone - start) / steps,
+            (batchDone - scalarDone) / steps,
+            mismatches);
+
+    freeUniverse(u);
+    free(scalarEvolution);
+    free(batchEvolution);
+    return mismatches == 0 ? 0 : 1;
+}
+
+/**
+ * Hot loops of `calls` love evaluations and countdowns, once through the
+ * God's function pointers and once through the devirtualized god* dispatch,
+ * reporting ns per call
+ */
+static int benchDispatch(FILE* report, int calls) {
+    God* g = createGod();
+    Universe* u = divineCreateUniverseArena();
+    bool ready = g && u && reserveEntities(u, BENCH_DISPATCH_ENTITIES);
+    for (int i = 0; ready && i < BENCH_DISPATCH_ENTITIES; i++) {
+        char name[MAX_NAME_LENGTH];
+        snprintf(name, sizeof(name), "Entity%d", i);
+        ready = createConsciousEntity(g, u, name) != NULL;
+    }
+    if (!ready) {
+        freeUniverse(u);
+        freeGod(g);
+        return 1;
+    }
+
+    ConsciousEntity** entities = u->consciousEntities;
+    long pointerLove = 0;
+    long directLove = 0;
+    long pointerDays = 0;
+    long directDays = 0;
+
+    divineClockBeginTick();
+    double start = benchNowNs();
+    for (int i = 0; i < calls; i++) {
+        pointerLove += g->loveIntensityFor(entities[i % BENCH_DISPATCH_ENTITIES]) > 0.0;
+    }
+    double pointerLoveDone = benchNowNs();
+    for (int i = 0; i < calls; i++) {
+        directLove += godLoveIntensityFor(g, entities[i % BENCH_DISPATCH_ENTITIES]) > 0.0;
+    }
+    double directLoveDone = benchNowNs();
+    for (int i = 0; i < calls; i++) {
+        pointerDays += g->daysToEndOfWorld(u);
+    }
+    double pointerDaysDone = benchNowNs();
+    for (int i = 0; i < calls; i++) {
+        directDays += godDaysToEndOfWorld(g, u);
+    }
+    double directDaysDone = benchNowNs();
+    divineClockEndTick();
+
+    fprintf(report, "%-9s pointer  %8.1f ns  direct %8.1f ns\n", "love",
+            (pointerLoveDone - start) / calls, (directLoveDone - pointerLoveDone) / calls);
+    fprintf(report, "%-9s pointer  %8.1f ns  direct %8.1f ns\n", "countdown",
+            (pointerDaysDone - directLoveDone) / calls, (directDaysDone - pointerDaysDone) / calls);
+
+    freeUniverse(u);
+    freeGod(g);
+    return pointerLove == directLove && pointerDays == directDays ? 0 : 1;
+}
+
+/**
+ * Build a knowledge base of `count` statements and query each of them once
+ * through God's omniscience, reporting ns per assertion and per query
+ */
+static int benchKnowledge(FILE* report, int count) {
+    KnowledgeBase* kb = createKnowledgeBase();
+    God* g = createGod();
+    if (!kb || !g || !knowledgeBaseReserve(kb, (size_t)count, (size_t)count * BENCH_STATEMENT_LENGTH)) {
+        freeKnowledgeBase(kb);
+        freeGod(g);
+        return 1;
+    }
+
+    char statement[BENCH_STATEMENT_LENGTH];
+    double start = benchNowNs();
+    for (int i = 0; i < count; i++) {
+        snprintf(statement, sizeof(statement), "Statement %d holds", i);
+        if (!knowledgeBaseAssert(kb, statement, i % 3 == 0)) {
+            freeKnowledgeBase(kb);
+            freeGod(g);
+            return 1;
+        }
+    }
+    double asserted = benchNowNs();
+
+    // Queries in a scattered order, as point lookups would arrive,
+    // formatted up front so only the lookups are timed
+    char* queries = (char*)malloc((size_t)count * BENCH_STATEMENT_LENGTH);
+    if (!queries) {
+        freeKnowledgeBase(kb);
+        freeGod(g);
+        return 1;
+    }
+    for (int i = 0; i < count; i++) {
+        snprintf(queries + (size_t)i * BENCH_STATEMENT_LENGTH, BENCH_STATEMENT_LENGTH,
+                 "Statement %d holds", (int)(((long)i * 7919) % count));
+    }
+
+    divineKnowledgeUse(kb);
+    int known = 0;
+    double queryStart = benchNowNs();
+    for (int i = 0; i < count; i++) {
+        Proposition p = { queries + (size_t)i * BENCH_STATEMENT_LENGTH, false };
+        known += g->knowsTruth(&p);
+    }
+    double queried = benchNowNs();
+    divineKnowledgeUse(NULL);
+
+    // Every third statement holds
+    int expected = 0;
+    for (int i = 0; i < count; i++) {
+        expected += (int)(((long)i * 7919) % count) % 3 == 0;
+    }
+    int mismatches = abs(expected - known);
+
+    fprintf(report, "%-9s assert %8.1f ns  query %8.1f ns  (mismatches %d)\n",
+            "knowledge",
+            (asserted - start) / count,
+            (queried - queryStart) / count,
+            mismatches);
+
+    free(queries);
+    freeKnowledgeBase(kb);
+    freeGod(g);
+    return mismatches == 0 ? 0 : 1;
+}
+
+static void printBenchUsage(const char* program) {
+    printf("Usage: %s [options]\n", program);
+    printf("  --entities N     entities in each benchmark universe (default %d)\n", DEFAULT_BENCH_ENTITIES);
+    printf("  --constants N    physical constants per universe (default %d)\n", DEFAULT_NUM_CONSTANTS);
+    printf("  --threads N      threads running each benchmark at once (default %d)\n", DEFAULT_BENCH_THREADS);
+    printf("  --iterations N   timed calls per thread and function (default %d)\n", DEFAULT_BENCH_ITERATIONS);
+    printf("  --warmup N       untimed calls per thread before each repetition (default %d)\n", DEFAULT_BENCH_WARMUP);
+    printf("  --repetitions N  runs of each function, the median reported (default %d)\n",
+           DEFAULT_BENCH_REPETITIONS);
+    printf("  --universes N    universes for the layout and countdown comparisons, 0 skips them (default %d)\n",
+           DEFAULT_BENCH_UNIVERSES);
+    printf("  --steps N        time points for the evolve comparison, 0 skips it (default %d)\n", DEFAULT_BENCH_STEPS);
+    printf("  --statements N   statements for the knowledge comparison, 0 skips it (default %d)\n",
+           DEFAULT_BENCH_STATEMENTS);
+    printf("  --calls N        calls per loop of the dispatch comparison, 0 skips it (default %d)\n",
+           DEFAULT_BENCH_CALLS);
+    printf("  --json FILE      write the results as JSON, - for stdout\n");
+    printf("  --baseline FILE  compare against earlier --json results, failing on regressions\n");
+    printf("  --tolerance PCT  regression allowed against the baseline (default %.0f)\n", DEFAULT_BENCH_TOLERANCE);
+}
+
+/**
+ * Parse the command line, false on a bad option
+ */
+static bool parseBenchOptions(int argc, char** argv, BenchConfig* config) {
+    for (int i = 1; i < argc; i++) {
+        const char* option = argv[i];
+        if (i + 1 >= argc) return false;
+        const char* value = argv[++i];
+
+        if (strcmp(option, "--entities") == 0) config->entities = atoi(value);
+        else if (strcmp(option, "--constants") == 0) config->constants = atoi(value);
+        else if (strcmp(option, "--threads") == 0) config->threads = atoi(value);
+        else if (strcmp(option, "--iterations") == 0) config->iterations = atoi(value);
+        else if (strcmp(option, "--warmup") == 0) config->warmup = atoi(value);
+        else if (strcmp(option, "--repetitions") == 0) config->repetitions = atoi(value);
+        else if (strcmp(option, "--universes") == 0) config->universes = atoi(value);
+        else if (strcmp(option, "--steps") == 0) config->steps = atoi(value);
+        else if (strcmp(option, "--statements") == 0) config->statements = atoi(value);
+        else if (strcmp(option, "--calls") == 0) config->calls = atoi(value);
+        else if (strcmp(option, "--json") == 0) config->json = value;
+        else if (strcmp(option, "--baseline") == 0) config->baseline = value;
+        else if (strcmp(option, "--tolerance") == 0) config->tolerance = atof(value);
+        else return false;
+    }
+
+    return config->entities > 0 && config->constants > 0 && config->threads > 0 &&
+           config->iterations > 0 && config->warmup >= 0 && config->repetitions > 0 &&
+           config->universes >= 0 && config->steps >= 0 && config->statements >= 0 &&
+           config->calls >= 0 && config->tolerance >= 0.0;
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config = {
+        DEFAULT_BENCH_ENTITIES, DEFAULT_NUM_CONSTANTS, DEFAULT_BENCH_THREADS,
+        DEFAULT_BENCH_ITERATIONS, DEFAULT_BENCH_WARMUP, DEFAULT_BENCH_REPETITIONS,
+        DEFAULT_BENCH_UNIVERSES, DEFAULT_BENCH_STEPS, DEFAULT_BENCH_STATEMENTS, DEFAULT_BENCH_CALLS,
+        NULL, NULL, DEFAULT_BENCH_TOLERANCE
+    };
+    if (!parseBenchOptions(argc, argv, &config)) {
+        printBenchUsage(argv[0]);
+        return 1;
+    }
+
+    // With JSON on stdout the human-readable report moves to stderr
+    FILE* report = config.json && strcmp(config.json, "-") == 0 ? stderr : stdout;
+
+    double timerOverhead = benchTimerOverhead();
+    fprintf(report, "Function benchmark: %d entities, %d constants, %d threads, %d iterations per thread\n",
+            config.entities, config.constants, config.threads, config.iterations);
+    fprintf(report, "Median of %d repetitions, each on a fresh universe after %d warmup calls per thread\n",
+            config.repetitions, config.warmup);
+    fprintf(report, "Latencies include %.1f ns of clock reading\n", timerOverhead);
+    fprintf(report, "%-22s %14s %10s %10s %10s %9s\n", "function", "ops/s", "p50 ns", "p99 ns", "p999 ns", "spread");
+
+    BenchResult results[BENCH_FUNCTION_COUNT];
+    for (int i = 0; i < BENCH_FUNCTION_COUNT; i++) {
+        if (!measureBenchFunction(&benchFunctions[i], &config, &results[i])) {
+            fprintf(report, "%s: setup failed or out of memory\n", benchFunctions[i].name);
+            return 1;
+        }
+        fprintf(report, "%-22s %14.0f %10.1f %10.1f %10.1f %8.1f%%\n", results[i].name,
+                results[i].opsPerSecond, results[i].p50, results[i].p99, results[i].p999, results[i].spread);
+    }
+    int status = 0;
+
+    if (config.json && !writeBenchJson(config.json, &config, timerOverhead, results, BENCH_FUNCTION_COUNT)) {
+        fprintf(report, "Could not write %s\n", config.json);
+        return 1;
+    }
+
+    if (config.baseline) {
+        int regressions = compareBenchBaseline(report, config.baseline, config.tolerance,
+                                               results, BENCH_FUNCTION_COUNT);
+        if (regressions < 0) {
+            fprintf(report, "Could not read baseline %s\n", config.baseline);
+            return 1;
+        }
+        if (regressions > 0) status = 2;
+    }
+
+    if (config.universes > 0) {
+        fprintf(report, "\nUniverse layout benchmark: %d universes, ns per universe\n", config.universes);
+        if (benchUniverseLayout(report, "separate", &divineCreateUniverse, config.universes) != 0) return 1;
+        if (benchUniverseLayout(report, "arena", &divineCreateUniverseArena, config.universes) != 0) return 1;
+        if (benchEschatology(report, config.universes) != 0) return 1;
+    }
+
+    if (config.steps > 0) {
+        fprintf(report, "\nEvolution benchmark: %d time points, ns per point\n", config.steps);
+        if (benchEvolution(report, config.steps) != 0) return 1;
+    }
+
+    if (config.statements > 0) {
+        fprintf(report, "\nKnowledge benchmark: %d statements, ns per statement\n", config.statements);
+        if (benchKnowledge(report, config.statements) != 0) return 1;
+    }
+
+    if (config.calls > 0) {
+        fprintf(report, "\nAttribute dispatch benchmark: %d calls, ns per call\n", config.calls);
+        if (benchDispatch(report, config.calls) != 0) return 1;
+    }
+
+    return status;
+}
@@ -0,0 +1,113 @@
+/**
+ * main.c - Simulation demo for libgod
+ * 
+ * A metaphorical simulation of creation and divine interaction, built on
+ * the library in god.c.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "god.h"
+
+/**
+ * Main function - a metaphorical simulation of creation and divine interaction
+ */
+int main() {
+    printf("Starting divine simulation...\n");
+    
+    // Instantiate God
+    God* omega = createGod();
+    if (!omega) {
+        printf("Failed to create God instance\n");
+        return 1;
+    }
+    
+    printf("God instance created - divine attributes initialized\n");
+    
+    // Creation
+    Universe* universe = omega->createUniverse();
+    if (!universe) {
+        printf("Universe creation failed\n");
+        freeGod(omega);
+        return 1;
+    }
+    
+    printf("Universe created with %d physical constants\n", universe->numConstants);
+    
+    // Create time
+    TimePoint beginning = {0.0, false};
+    
+    // Create humans
+    ConsciousEntity* human1 = createConsciousEntity(omega, universe, "Human1");
+    ConsciousEntity* human2 = createConsciousEntity(omega, universe, "Human2");
+    
+    if (!human1 || !human2) {
+        printf("Failed to create conscious entities\n");
+        freeUniverse(universe);
+        freeGod(omega);
+        return 1;
+    }
+    
+    printf("Created conscious entities: %s and %s\n", human1->name, human2->name);
+    
+    // Divine-human relationship
+    printf("Divine love for %s: %f (conceptual infinity)\n", 
+           human1->name, omega->loveIntensityFor(human1));
+    
+    // Human prayer
+    char* prayer = human1->formPrayer(human1);
+    if (!prayer) {
+        printf("Prayer formation failed\n");
+        freeUniverse(universe);
+        freeGod(omega);
+        return 1;
+    }
+    
+    printf("Prayer received: %s\n", prayer);
+    
+    // Divine response to prayer
+    Universe* updatedUniverse = omega->respondToPrayer(human1, prayer, universe);
+    if (!updatedUniverse) {
+        printf("Divine response failed\n");
+        free(prayer);
+        freeUniverse(universe);
+        freeGod(omega);
+        return 1;
+    }
+    
+    printf("Divine response processed - universe updated\n");
+    
+    // Calculate the days until the end of the world
+    long daysRemaining = omega->daysToEndOfWorld(universe);
+    printf("\n===============================================\n");
+    printf("DIVINE REVELATION: DAYS UNTIL END OF THE WORLD\n");
+    printf("===============================================\n");
+    printf("%ld days\n", daysRemaining);
+    printf("===============================================\n\n");
+    
+    // Progress toward teological end
+    TimePoint end = {INFINITY_REPRESENTATION, true};
+    Universe* completedUniverse = omega->completeUniverse(universe);
+    if (!completedUniverse) {
+        printf("Universe completion failed\n");
+        free(prayer);
+        freeUniverse(updatedUniverse);
+        freeUniverse(universe);
+        freeGod(omega);
+        return 1;
+    }
+    
+    printf("Universe teleologically completed\n");
+    
+    // Cleanup - FIXED: proper memory management
+    free(prayer);
+    freeUniverse(completedUniverse);
+    freeUniverse(updatedUniverse);
+    freeUniverse(universe);
+    freeGod(omega);
+    
+    printf("Divine simulation completed successfully\n");
+    
+    return 0;
+}
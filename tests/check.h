@@ -0,0 +1,26 @@
+/**
+ * check.h - Checks for the libgod tests
+ *
+ * CHECK reports a failed condition and carries on, so one run lists every
+ * failure; a test's main returns CHECK_RESULT() for CTest.
+ */
+
+#ifndef GOD_TEST_CHECK_H
+#define GOD_TEST_CHECK_H
+
+#include <stdio.h>
+
+static int checkFailures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__,    \
+                    #condition);                                                \
+            checkFailures++;                                                    \
+        }                                                                       \
+    } while (0)
+
+#define CHECK_RESULT() (checkFailures == 0 ? 0 : 1)
+
+#endif /* GOD_TEST_CHECK_H */
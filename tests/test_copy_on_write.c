@@ -0,0 +1,161 @@
+/**
+ * test_copy_on_write.c - Tests of shared universe payloads
+ *
+ * A fork shares the payload arrays of its origin until either side writes,
+ * which copies the array for the writer alone. The default constants are
+ * shared by every universe and never freed or written, and the payload of
+ * an arena universe lives on in its forks after the universe is freed.
+ */
+
+#include <stdlib.h>
+
+#include "god.h"
+#include "check.h"
+
+#define SPEED_OF_LIGHT 299792458.0
+#define FORKS 100
+
+/**
+ * Whether a universe shares every payload array with another
+ */
+static bool sharesPayload(const Universe* a, const Universe* b) {
+    return a->physicalConstants == b->physicalConstants && a->spacetime == b->spacetime &&
+           a->matter == b->matter && a->energy == b->energy;
+}
+
+/**
+ * Whether constants are the defaults every universe starts out with
+ */
+static bool defaultConstants(const Universe* u) {
+    if (u->numConstants != DEFAULT_NUM_CONSTANTS) return false;
+    for (int i = 4; i < u->numConstants; i++) {
+        if (u->physicalConstants[i] != 1.0 / (i + 1)) return false;
+    }
+    return u->physicalConstants[0] == SPEED_OF_LIGHT;
+}
+
+static void testForkSharesPayload(Universe* (*create)(void)) {
+    Universe* u = create();
+    CHECK(u && universeSetConstant(u, 1, 2.0));
+    if (!u) return;
+    *(double*)universeWritableMatter(u) = 3.0;
+
+    Universe* fork = forkUniverse(u);
+    CHECK(fork != NULL);
+    if (!fork) {
+        freeUniverse(u);
+        return;
+    }
+    CHECK(sharesPayload(fork, u));
+
+    // Writing to the fork copies just the array written, the origin keeps its values
+    const double* shared = fork->physicalConstants;
+    CHECK(universeSetConstant(fork, 1, 5.0));
+    CHECK(fork->physicalConstants != shared && u->physicalConstants == shared);
+    CHECK(fork->physicalConstants[1] == 5.0 && u->physicalConstants[1] == 2.0);
+    CHECK(fork->physicalConstants[0] == SPEED_OF_LIGHT);
+    CHECK(fork->matter == u->matter && fork->spacetime == u->spacetime);
+
+    double* matter = universeWritableMatter(fork);
+    CHECK(matter && matter != u->matter);
+    if (matter) *matter = 7.0;
+    CHECK(*(double*)u->matter == 3.0);
+
+    double* spacetime = universeWritableSpacetime(fork);
+    CHECK(spacetime && spacetime != u->spacetime);
+    if (spacetime) spacetime[3] = 1.5;
+    CHECK(((double*)u->spacetime)[3] == 0.0);
+
+    // Writing to the origin copies too while the fork still shares energy
+    double* energy = universeWritableEnergy(u);
+    CHECK(energy && energy != fork->energy);
+    if (energy) *energy = 9.0;
+    CHECK(*(double*)fork->energy == 1.0);
+
+    // Once the fork is gone the origin is the sole owner and writes in place
+    Universe* second = forkUniverse(u);
+    CHECK(second && second->matter == u->matter);
+    freeUniverse(second);
+    CHECK(universeWritableMatter(u) == u->matter);
+    CHECK(universeWritableConstants(u) == u->physicalConstants);
+
+    freeUniverse(fork);
+    freeUniverse(u);
+}
+
+static void testDefaultConstants(void) {
+    Universe* first = divineCreateUniverse();
+    Universe* second = divineCreateUniverseArena();
+    CHECK(first && second);
+    if (!first || !second) {
+        freeUniverse(first);
+        freeUniverse(second);
+        return;
+    }
+    const double* defaults = first->physicalConstants;
+    CHECK(second->physicalConstants == defaults);
+    CHECK(defaultConstants(first));
+
+    // Forking and freeing never frees the shared table
+    Universe* forks[FORKS];
+    for (int i = 0; i < FORKS; i++) forks[i] = forkUniverse(i % 2 ? first : second);
+    for (int i = 0; i < FORKS; i++) {
+        CHECK(forks[i] && forks[i]->physicalConstants == defaults);
+        freeUniverse(forks[i]);
+    }
+    freeUniverse(second);
+
+    // Even a universe alone with the defaults copies them before writing
+    double* constants = universeWritableConstants(first);
+    CHECK(constants && constants != defaults);
+    if (constants) constants[0] = 1.0;
+    CHECK(universeResizeConstants(first, 5));
+
+    Universe* later = divineCreateUniverse();
+    CHECK(later && later->physicalConstants == defaults && defaultConstants(later));
+
+    freeUniverse(later);
+    freeUniverse(first);
+}
+
+static void testArenaOutlivesUniverse(void) {
+    Universe* u = divineCreateUniverseArena();
+    CHECK(u != NULL);
+    if (!u) return;
+    *(double*)universeWritableMatter(u) = 4.0;
+    ((double*)universeWritableSpacetime(u))[2] = 6.0;
+
+    Universe* first = forkUniverse(u);
+    Universe* second = forkUniverse(u);
+    CHECK(first && second);
+    freeUniverse(u);
+
+    // The forks still read the arena payload after its universe is freed
+    CHECK(first && *(double*)first->matter == 4.0 && ((double*)first->spacetime)[2] == 6.0);
+    CHECK(second && second->matter == (first ? first->matter : NULL));
+
+    // A write by one fork leaves the other on the arena payload
+    if (first && second) {
+        double* matter = universeWritableMatter(first);
+        CHECK(matter && matter != second->matter);
+        CHECK(*(double*)second->matter == 4.0);
+        freeUniverse(first);
+        CHECK(*(double*)second->matter == 4.0 && ((double*)second->spacetime)[2] == 6.0);
+
+        // The last fork is the sole owner and writes in place
+        CHECK(universeWritableSpacetime(second) == second->spacetime);
+    } else {
+        freeUniverse(first);
+    }
+
+    freeUniverse(second);
+}
+
+int main(void) {
+    testForkSharesPayload(&divineCreateUniverse);
+    testForkSharesPayload(&divineCreateUniverseArena);
+    testDefaultConstants();
+    testArenaOutlivesUniverse();
+
+    return CHECK_RESULT();
+}
@@ -0,0 +1,299 @@
+/**
+ * test_instrumentation.c - Tests of dispatch instrumentation
+ *
+ * Instrumenting a God swaps each of its function pointers for a wrapper and
+ * uninstrumenting restores them exactly. Wrapped calls are counted, latency
+ * histogram buckets bound every latency within 1/16, quantiles of known
+ * latencies land in the right buckets, and the JSON statistics parse.
+ *
+ * Built from god.c itself rather than against libgod, to reach the
+ * histogram and record known latencies.
+ */
+
+#include "../god.c"
+#include "check.h"
+
+#define STATS_PATH "test_instrumentation.json"
+#define CALLS 1000
+
+/* Cursor of the JSON checker */
+typedef struct JsonText {
+    const char* at;
+} JsonText;
+
+static bool jsonValue(JsonText* json);
+
+static void jsonSpace(JsonText* json) {
+    while (*json->at == ' ' || *json->at == '\n' || *json->at == '\r' || *json->at == '\t') json->at++;
+}
+
+static bool jsonString(JsonText* json) {
+    if (*json->at != '"') return false;
+    for (json->at++; *json->at != '"'; json->at++) {
+        if (*json->at == '\0' || (unsigned char)*json->at < 0x20) return false;
+        if (*json->at == '\\' && *++json->at == '\0') return false;
+    }
+    json->at++;
+    return true;
+}
+
+static bool jsonLiteral(JsonText* json, const char* literal) {
+    size_t length = strlen(literal);
+    if (strncmp(json->at, literal, length) != 0) return false;
+    json->at += length;
+    return true;
+}
+
+static bool jsonNumber(JsonText* json) {
+    char* end;
+    strtod(json->at, &end);
+    if (end == json->at || (*json->at != '-' && (*json->at < '0' || *json->at > '9'))) return false;
+    json->at = end;
+    return true;
+}
+
+/**
+ * Check the members of an object or elements of an array up to `close`
+ */
+static bool jsonMembers(JsonText* json, char close, bool named) {
+    json->at++;
+    jsonSpace(json);
+    if (*json->at == close) {
+        json->at++;
+        return true;
+    }
+    for (;;) {
+        if (named) {
+            if (!jsonString(json)) return false;
+            jsonSpace(json);
+            if (*json->at++ != ':') return false;
+        }
+        if (!jsonValue(json)) return false;
+        jsonSpace(json);
+        if (*json->at == close) {
+            json->at++;
+            return true;
+        }
+        if (*json->at++ != ',') return false;
+        jsonSpace(json);
+    }
+}
+
+static bool jsonValue(JsonText* json) {
+    jsonSpace(json);
+    switch (*json->at) {
+        case '{': return jsonMembers(json, '}', true);
+        case '[': return jsonMembers(json, ']', false);
+        case '"': return jsonString(json);
+        case 't': return jsonLiteral(json, "true");
+        case 'f': return jsonLiteral(json, "false");
+        case 'n': return jsonLiteral(json, "null");
+        default: return jsonNumber(json);
+    }
+}
+
+/**
+ * Whether `text` is exactly one JSON value
+ */
+static bool parsesAsJson(const char* text) {
+    JsonText json = { text };
+    if (!jsonValue(&json)) return false;
+    jsonSpace(&json);
+    return *json.at == '\0';
+}
+
+/**
+ * Whether two Gods have the same function pointers
+ */
+static bool sameAttributes(const God* a, const God* b) {
+    bool same = true;
+#define SAME_ATTRIBUTE(Name, member, binding, type, parameters, arguments) \
+    same = same && a->member == b->member;
+    GOD_ATTRIBUTES(SAME_ATTRIBUTE)
+    GOD_VOID_ATTRIBUTES(SAME_ATTRIBUTE)
+#undef SAME_ATTRIBUTE
+    return same;
+}
+
+static double ownLove(const ConsciousEntity* e) {
+    (void)e;
+    return 0.5;
+}
+
+static void testSwapAndRestore(void) {
+    God* god = createGod();
+    CHECK(god != NULL);
+    if (!god) return;
+    God original = *god;
+
+    CHECK(divineInstrument(god));
+#define CHECK_WRAPPED(Name, member, binding, type, parameters, arguments) \
+    CHECK(god->member == &instrumented_##Name && dispatchOriginals.Name == original.member);
+    GOD_ATTRIBUTES(CHECK_WRAPPED)
+    GOD_VOID_ATTRIBUTES(CHECK_WRAPPED)
+#undef CHECK_WRAPPED
+
+    // Instrumenting twice wraps nothing twice
+    CHECK(divineInstrument(god));
+    CHECK(god->knowsTruth == &instrumented_KnowsTruth && dispatchOriginals.KnowsTruth == &omniscienceFunction);
+
+    divineUninstrument(god);
+    CHECK(sameAttributes(god, &original));
+    divineUninstrument(god);
+    CHECK(sameAttributes(god, &original));
+
+    // Another God with implementations of its own is refused, untouched
+    God* other = createGod();
+    CHECK(other != NULL);
+    if (other) {
+        other->daysToEndOfWorld = NULL;
+        other->loveIntensityFor = &ownLove;
+        God before = *other;
+        CHECK(!divineInstrument(other));
+        CHECK(sameAttributes(other, &before));
+        freeGod(other);
+    }
+
+    CHECK(!divineInstrument(NULL));
+    freeGod(god);
+}
+
+static void testCallCounts(void) {
+    God* god = createGod();
+    Universe* u = divineCreateUniverse();
+    CHECK(god && u);
+    if (!god || !u) return;
+
+    divineStatsReset();
+    CHECK(divineInstrument(god));
+
+    char statement[] = "counted";
+    Proposition p = { statement, true };
+    for (int i = 0; i < CALLS; i++) CHECK(godKnowsTruth(god, &p));
+    for (int i = 0; i < CALLS / 2; i++) godDaysToEndOfWorld(god, u);
+    godExists(god);
+    godProjectIntoTime(god, NULL);
+
+    DispatchSummary s;
+    summarizeDispatch(DIVINE_ATTRIBUTE_KnowsTruth, &s);
+    CHECK(s.calls == CALLS && s.maxNs >= s.p99Ns && s.p99Ns >= s.p50Ns && s.totalNs >= s.maxNs);
+    summarizeDispatch(DIVINE_ATTRIBUTE_DaysToEndOfWorld, &s);
+    CHECK(s.calls == CALLS / 2);
+    summarizeDispatch(DIVINE_ATTRIBUTE_Exists, &s);
+    CHECK(s.calls == 1);
+    summarizeDispatch(DIVINE_ATTRIBUTE_ProjectIntoTime, &s);
+    CHECK(s.calls == 1);
+    summarizeDispatch(DIVINE_ATTRIBUTE_CreateUniverse, &s);
+    CHECK(s.calls == 0 && s.p50Ns == 0 && s.maxNs == 0);
+
+    // Calls after uninstrumenting go uncounted
+    divineUninstrument(god);
+    godKnowsTruth(god, &p);
+    summarizeDispatch(DIVINE_ATTRIBUTE_KnowsTruth, &s);
+    CHECK(s.calls == CALLS);
+
+    divineStatsReset();
+    summarizeDispatch(DIVINE_ATTRIBUTE_KnowsTruth, &s);
+    CHECK(s.calls == 0 && s.totalNs == 0);
+
+    freeUniverse(u);
+    freeGod(god);
+}
+
+static void testBuckets(void) {
+    // Exact below 16 ns
+    for (unsigned long ns = 0; ns < 16; ns++) {
+        CHECK(latencyBucket(ns) == (int)ns && latencyBucketLimit((int)ns) == ns);
+    }
+
+    // Buckets are contiguous, each ending at its limit and within 1/16 of it
+    int wrong = 0;
+    int bucket = latencyBucket(16);
+    for (unsigned long ns = 16; ns < (1ul << 22); ns++) {
+        if (latencyBucket(ns) != bucket) {
+            wrong += latencyBucket(ns) != bucket + 1 || latencyBucketLimit(bucket) != ns - 1;
+            bucket = latencyBucket(ns);
+        }
+        unsigned long limit = latencyBucketLimit(bucket);
+        wrong += limit < ns || (limit - ns) * 16 > ns;
+    }
+    CHECK(wrong == 0);
+    CHECK(latencyBucket(100) == 57 && latencyBucketLimit(57) == 103);
+    CHECK(latencyBucketLimit(latencyBucket(1000)) == 1023);
+
+    // Past the largest exponent everything lands in the last bucket
+    CHECK(latencyBucket(~0ul) == LATENCY_BUCKETS - 1);
+    CHECK(latencyBucket(1ul << (LATENCY_MAX_EXPONENT + 1)) == LATENCY_BUCKETS - 1);
+    CHECK(latencyBucket((1ul << (LATENCY_MAX_EXPONENT + 1)) - 1) == LATENCY_BUCKETS - 1);
+}
+
+static void testQuantiles(void) {
+    divineStatsReset();
+
+    // 98 calls of 100 ns, one of 1000 ns and one of 5000 ns
+    for (int i = 0; i < 98; i++) recordLatency(DIVINE_ATTRIBUTE_Reveal, 100);
+    recordLatency(DIVINE_ATTRIBUTE_Reveal, 1000);
+    recordLatency(DIVINE_ATTRIBUTE_Reveal, 5000);
+
+    DispatchSummary s;
+    summarizeDispatch(DIVINE_ATTRIBUTE_Reveal, &s);
+    CHECK(s.calls == 100);
+    CHECK(s.totalNs == 98 * 100 + 1000 + 5000);
+    CHECK(s.maxNs == 5000);
+    CHECK(s.p50Ns == 103);   // Limit of the bucket of 100 ns
+    CHECK(s.p90Ns == 103);
+    CHECK(s.p99Ns == 1023);  // The 99th call, limit of the bucket of 1000 ns
+    CHECK(s.p999Ns == 5000); // Its bucket's limit, 5119, capped at the largest call
+
+    // A single call is every quantile
+    recordLatency(DIVINE_ATTRIBUTE_Exists, 7);
+    summarizeDispatch(DIVINE_ATTRIBUTE_Exists, &s);
+    CHECK(s.calls == 1 && s.p50Ns == 7 && s.p999Ns == 7);
+
+    divineStatsReset();
+}
+
+static void testJson(void) {
+    divineStatsReset();
+    recordLatency(DIVINE_ATTRIBUTE_KnowsTruth, 100);
+    recordLatency(DIVINE_ATTRIBUTE_KnowsTruth, 200);
+
+    FILE* out = fopen(STATS_PATH, "w+");
+    CHECK(out != NULL);
+    if (!out) return;
+    CHECK(divineStatsWriteJson(out));
+
+    char text[16384];
+    rewind(out);
+    size_t length = fread(text, 1, sizeof(text) - 1, out);
+    text[length] = '\0';
+    fclose(out);
+    remove(STATS_PATH);
+
+    CHECK(length > 0 && length < sizeof(text) - 1);
+    CHECK(parsesAsJson(text));
+    CHECK(strstr(text, "{\"name\": \"KnowsTruth\", \"calls\": 2, \"total_ns\": 300, \"max_ns\": 200,") != NULL);
+    for (int a = 0; a < DIVINE_ATTRIBUTE_COUNT; a++) {
+        char name[64];
+        snprintf(name, sizeof(name), "\"name\": \"%s\"", divineAttributeNames[a]);
+        CHECK(strstr(text, name) != NULL);
+    }
+
+    // The checker itself turns damaged JSON away
+    CHECK(!parsesAsJson("{\"a\": [1, 2,]}"));
+    CHECK(!parsesAsJson("{\"a\" 1}"));
+    CHECK(!parsesAsJson("[1] 2"));
+    CHECK(!divineStatsWriteJson(NULL));
+
+    divineStatsReset();
+}
+
+int main(void) {
+    testSwapAndRestore();
+    testCallCounts();
+    testBuckets();
+    testQuantiles();
+    testJson();
+
+    return CHECK_RESULT();
+}
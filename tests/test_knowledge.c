@@ -0,0 +1,202 @@
+/**
+ * test_knowledge.c - Tests of the knowledge base
+ *
+ * Asserting, overriding and querying statements, growth well past the
+ * initial capacity, statements that are prefixes of one another, loading
+ * statement files (malformed lines, "\r\n" endings, embedded NULs, later
+ * lines overriding earlier ones), omniscienceFunction consulting the
+ * divine knowledge base before falling back to the proposition, and
+ * falling back once the divine knowledge base is freed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "god.h"
+#include "check.h"
+
+#define KNOWLEDGE_PATH "test_knowledge.txt"
+#define MANY_STATEMENTS 50000
+
+static bool writeKnowledgeFile(const char* text, size_t length) {
+    FILE* out = fopen(KNOWLEDGE_PATH, "wb");
+    if (!out) return false;
+    bool written = fwrite(text, 1, length, out) == length;
+    return fclose(out) == 0 && written;
+}
+
+/**
+ * Whether a knowledge base knows `statement` with truth `expected`
+ */
+static bool knows(const KnowledgeBase* kb, const char* statement, bool expected) {
+    bool truth = !expected;
+    return knowledgeBaseQuery(kb, statement, &truth) && truth == expected;
+}
+
+static void testAssertAndQuery(void) {
+    KnowledgeBase* kb = createKnowledgeBase();
+    CHECK(kb != NULL);
+    if (!kb) return;
+
+    bool truth;
+    CHECK(knowledgeBaseSize(kb) == 0);
+    CHECK(!knowledgeBaseQuery(kb, "light is good", &truth));
+
+    CHECK(knowledgeBaseAssert(kb, "light is good", true));
+    CHECK(knowledgeBaseAssert(kb, "light", false));
+    CHECK(knowledgeBaseAssert(kb, "light is good and", false));
+    CHECK(knowledgeBaseAssert(kb, "", true));
+    CHECK(knowledgeBaseSize(kb) == 4);
+    CHECK(knows(kb, "light is good", true));
+    CHECK(knows(kb, "light", false));
+    CHECK(knows(kb, "light is good and", false));
+    CHECK(knows(kb, "", true));
+    CHECK(!knowledgeBaseQuery(kb, "light is", &truth));
+
+    // Asserting a known statement changes its truth, not the size
+    CHECK(knowledgeBaseAssert(kb, "light", true));
+    CHECK(knows(kb, "light", true));
+    CHECK(knowledgeBaseSize(kb) == 4);
+
+    CHECK(!knowledgeBaseAssert(NULL, "x", true));
+    CHECK(!knowledgeBaseAssert(kb, NULL, true));
+    CHECK(!knowledgeBaseQuery(NULL, "light", &truth));
+    CHECK(!knowledgeBaseQuery(kb, "light", NULL));
+
+    freeKnowledgeBase(kb);
+}
+
+static void testGrowth(bool reserved) {
+    KnowledgeBase* kb = createKnowledgeBase();
+    CHECK(kb != NULL);
+    if (!kb) return;
+    if (reserved) CHECK(knowledgeBaseReserve(kb, MANY_STATEMENTS, (size_t)MANY_STATEMENTS * 24));
+
+    char statement[32];
+    for (int i = 0; i < MANY_STATEMENTS; i++) {
+        snprintf(statement, sizeof(statement), "statement %d", i);
+        CHECK(knowledgeBaseAssert(kb, statement, i % 3 == 0));
+    }
+    CHECK(knowledgeBaseSize(kb) == MANY_STATEMENTS);
+
+    int wrong = 0;
+    for (int i = 0; i < MANY_STATEMENTS; i++) {
+        snprintf(statement, sizeof(statement), "statement %d", i);
+        wrong += !knows(kb, statement, i % 3 == 0);
+    }
+    CHECK(wrong == 0);
+    CHECK(!knows(kb, "statement -1", true) && !knows(kb, "statement -1", false));
+
+    freeKnowledgeBase(kb);
+}
+
+static void testLoad(void) {
+    static const char text[] =
+        "1 the earth is round\n"
+        "0 the earth is flat\r\n"
+        "2 not a truth value\n"
+        "1no space\n"
+        "1 \n"
+        "\n"
+        "0 has a \0 nul\n"
+        "0 the earth is round\n" // Overrides the first line
+        "1 last line without newline";
+    KnowledgeBase* kb = createKnowledgeBase();
+    CHECK(kb && writeKnowledgeFile(text, sizeof(text) - 1));
+    if (!kb) return;
+
+    CHECK(knowledgeBaseLoad(kb, KNOWLEDGE_PATH) == 4);
+    CHECK(knowledgeBaseSize(kb) == 3);
+    CHECK(knows(kb, "the earth is round", false));
+    CHECK(knows(kb, "the earth is flat", false));
+    CHECK(knows(kb, "last line without newline", true));
+    bool truth;
+    CHECK(!knowledgeBaseQuery(kb, "the earth is flat\r", &truth));
+    CHECK(!knowledgeBaseQuery(kb, "has a ", &truth));
+    CHECK(!knowledgeBaseQuery(kb, "not a truth value", &truth));
+
+    // Loading adds to what is known
+    static const char more[] = "1 the earth is flat\n1 water is wet\n";
+    CHECK(writeKnowledgeFile(more, sizeof(more) - 1));
+    CHECK(knowledgeBaseLoad(kb, KNOWLEDGE_PATH) == 2);
+    CHECK(knowledgeBaseSize(kb) == 4);
+    CHECK(knows(kb, "the earth is flat", true));
+    CHECK(knows(kb, "water is wet", true));
+
+    CHECK(writeKnowledgeFile("", 0));
+    CHECK(knowledgeBaseLoad(kb, KNOWLEDGE_PATH) == 0);
+    CHECK(knowledgeBaseLoad(kb, "no/such/" KNOWLEDGE_PATH) == -1);
+    CHECK(knowledgeBaseLoad(NULL, KNOWLEDGE_PATH) == -1);
+
+    freeKnowledgeBase(kb);
+}
+
+static void testOmniscience(void) {
+    KnowledgeBase* kb = createKnowledgeBase();
+    CHECK(kb && knowledgeBaseAssert(kb, "known and true", true));
+    CHECK(kb && knowledgeBaseAssert(kb, "known and false", false));
+    if (!kb) return;
+
+    char knownTrue[] = "known and true";
+    char knownFalse[] = "known and false";
+    char unknown[] = "unknown";
+    Proposition claimsFalse = { knownTrue, false };
+    Proposition claimsTrue = { knownFalse, true };
+    Proposition fallback = { unknown, true };
+    Proposition noStatement = { NULL, true };
+
+    // The carried truth until a knowledge base is consulted
+    CHECK(!omniscienceFunction(&claimsFalse));
+    CHECK(omniscienceFunction(&claimsTrue));
+
+    divineKnowledgeUse(kb);
+    CHECK(omniscienceFunction(&claimsFalse));
+    CHECK(!omniscienceFunction(&claimsTrue));
+    CHECK(omniscienceFunction(&fallback));
+    CHECK(omniscienceFunction(&noStatement));
+    CHECK(!omniscienceFunction(NULL));
+
+    God* god = createGod();
+    CHECK(god && godKnowsTruth(god, &claimsFalse));
+    freeGod(god);
+
+    divineKnowledgeUse(NULL);
+    CHECK(!omniscienceFunction(&claimsFalse));
+
+    freeKnowledgeBase(kb);
+}
+
+static void testFreeWhileUsed(void) {
+    KnowledgeBase* kb = createKnowledgeBase();
+    KnowledgeBase* other = createKnowledgeBase();
+    CHECK(kb && knowledgeBaseAssert(kb, "known and true", true));
+    if (!kb || !other) return;
+
+    char knownTrue[] = "known and true";
+    Proposition claimsFalse = { knownTrue, false };
+
+    // Freeing another knowledge base leaves the divine one in use
+    divineKnowledgeUse(kb);
+    freeKnowledgeBase(other);
+    CHECK(omniscienceFunction(&claimsFalse));
+
+    // Freeing the divine one falls back to the carried truth
+    freeKnowledgeBase(kb);
+    CHECK(!omniscienceFunction(&claimsFalse));
+
+    God* god = createGod();
+    CHECK(god && !godKnowsTruth(god, &claimsFalse));
+    freeGod(god);
+}
+
+int main(void) {
+    testAssertAndQuery();
+    testGrowth(false);
+    testGrowth(true);
+    testLoad();
+    testOmniscience();
+    testFreeWhileUsed();
+
+    remove(KNOWLEDGE_PATH);
+    return CHECK_RESULT();
+}
@@ -0,0 +1,215 @@
+/**
+ * test_multiverse.c - Tests of the multiverse registry and its bulk operations
+ *
+ * Adding and removing universes keeps the registry dense - including
+ * removing the last universe, removing twice and emptying it - and bulk
+ * evolution, end-of-world countdowns and God's projection agree with the
+ * same calls made universe by universe, on the caller and on a scheduler.
+ */
+
+#include <stdlib.h>
+
+#include "god.h"
+#include "check.h"
+
+#define UNIVERSES 5001 // Several scheduler tasks, the last one partial
+#define STEPS 37
+
+/**
+ * A law other than the built-in one, so bulk evolution must call it
+ */
+static double steadyLaw(const TimePoint* t) {
+    return t ? 2.0 * t->temporalCoordinate : 0.0;
+}
+
+static void testAddAndRemove(void) {
+    Multiverse* m = createMultiverse(0);
+    CHECK(m && m->count == 0);
+    if (!m) return;
+
+    Universe* a = divineCreateUniverse();
+    Universe* b = divineCreateUniverse();
+    Universe* c = divineCreateUniverse();
+    CHECK(multiverseAdd(m, a) == 0);
+    CHECK(multiverseAdd(m, b) == 1);
+    CHECK(multiverseAdd(m, c) == 2);
+    CHECK(multiverseAdd(m, NULL) == -1 && multiverseAdd(NULL, a) == -1);
+    CHECK(multiverseCreateUniverses(m, 2) == 3 && m->count == 5);
+    CHECK(multiverseCreateUniverses(m, 0) == 5 && m->count == 5);
+    CHECK(multiverseCreateUniverses(m, -1) == -1);
+    Universe* d = m->universes[3];
+    Universe* e = m->universes[4];
+
+    // The last universe moves into the removed one's index
+    CHECK(multiverseRemove(m, 1) == b);
+    CHECK(m->count == 4 && m->universes[1] == e);
+    freeUniverse(b);
+
+    // Removing the last universe moves nothing
+    CHECK(multiverseRemove(m, 3) == d);
+    CHECK(m->count == 3 && m->universes[0] == a && m->universes[1] == e && m->universes[2] == c);
+    freeUniverse(d);
+
+    // Its index is gone, so removing it again finds nothing
+    CHECK(multiverseRemove(m, 3) == NULL);
+    CHECK(m->count == 3);
+    CHECK(multiverseRemove(m, -1) == NULL && multiverseRemove(NULL, 0) == NULL);
+
+    // Removing index 0 twice takes the universe that moved there
+    CHECK(multiverseRemove(m, 0) == a);
+    CHECK(multiverseRemove(m, 0) == c);
+    CHECK(m->count == 1 && m->universes[0] == e);
+    freeUniverse(a);
+    freeUniverse(c);
+
+    CHECK(multiverseRemove(m, 0) == e);
+    CHECK(m->count == 0 && multiverseRemove(m, 0) == NULL);
+    freeUniverse(e);
+
+    // An emptied multiverse takes universes again
+    CHECK(multiverseCreateUniverses(m, 3) == 0 && m->count == 3);
+
+    freeMultiverse(m);
+}
+
+static void testEmptyProjection(God* god) {
+    Multiverse* m = createMultiverse(4);
+    CHECK(m != NULL);
+    if (!m) return;
+
+    MultiverseProjection* projection = (MultiverseProjection*)godProjectIntoMultiverse(god, m);
+    CHECK(projection != NULL);
+    if (projection) {
+        CHECK(projection->universes == 0 && projection->entities == 0);
+        CHECK(projection->meanEntropy == 0.0 && projection->earliestEndOfWorld == -1);
+    }
+    freeProjection(projection);
+    CHECK(godProjectIntoMultiverse(god, NULL) == NULL);
+
+    freeMultiverse(m);
+}
+
+/**
+ * A multiverse of differing universes - entropy, lifespan, constants,
+ * population and natural laws all vary
+ */
+static Multiverse* createVariedMultiverse(God* god) {
+    Multiverse* m = createMultiverse(0);
+    if (!m || multiverseCreateUniverses(m, UNIVERSES / 2) != 0) return m;
+
+    char name[32];
+    for (int i = 0; i < UNIVERSES; i++) {
+        Universe* u = i < UNIVERSES / 2 ? m->universes[i] : divineCreateUniverse();
+        if (i >= UNIVERSES / 2 && multiverseAdd(m, u) != i) {
+            freeUniverse(u);
+            return m;
+        }
+
+        u->entropyLevel = 0.05 + 0.9 * (i % 97) / 97.0;
+        u->totalLifespanDays = 1000 + 37L * (i % 211);
+        if (i % 5 == 0) universeSetConstant(u, 2, 1.0 + i % 13);
+        if (i % 7 == 0) u->naturalLaws.evolve = &steadyLaw;
+        if (i % 11 == 0) {
+            u->naturalLaws.evolve = NULL;
+            u->naturalLaws.evolveBatch = NULL;
+        }
+        for (int k = 0; k < i % 4; k++) {
+            snprintf(name, sizeof(name), "Entity%d.%d", i, k);
+            createConsciousEntity(god, u, name);
+        }
+    }
+
+    return m;
+}
+
+static void testBulkMatchesSingle(God* god, const Multiverse* m, DivineScheduler* s) {
+    double* evolution = (double*)malloc(sizeof(double) * (size_t)m->count * STEPS);
+    double* single = (double*)malloc(sizeof(double) * STEPS);
+    long* days = (long*)malloc(sizeof(long) * (size_t)m->count);
+    CHECK(evolution && single && days);
+    if (!evolution || !single || !days) {
+        free(evolution);
+        free(single);
+        free(days);
+        return;
+    }
+
+    TimePoint t = { 12.5, false };
+    multiverseEvolve(s, m, &t, evolution);
+    int different = 0;
+    for (int i = 0; i < m->count; i++) {
+        const Universe* u = m->universes[i];
+        different += evolution[i] != (u->naturalLaws.evolve ? u->naturalLaws.evolve(&t) : 0.0);
+    }
+    CHECK(different == 0);
+
+    multiverseEvolveSteps(s, m, 1.0, 0.25, STEPS, evolution);
+    different = 0;
+    for (int i = 0; i < m->count; i++) {
+        bool evolved = universeEvolveSteps(m->universes[i], 1.0, 0.25, STEPS, single);
+        for (int k = 0; k < STEPS; k++) {
+            different += evolution[(size_t)i * STEPS + k] != (evolved ? single[k] : 0.0);
+        }
+    }
+    CHECK(different == 0);
+
+    multiverseEndOfWorld(s, m, days);
+    different = 0;
+    long entities = 0;
+    double entropy = 0.0;
+    long earliest = -1;
+    for (int i = 0; i < m->count; i++) {
+        const Universe* u = m->universes[i];
+        long expected = calculateEndOfWorld(u);
+        different += days[i] != expected;
+        entities += u->numEntities;
+        entropy += u->entropyLevel;
+        if (earliest < 0 || expected < earliest) earliest = expected;
+    }
+    CHECK(different == 0);
+
+    MultiverseProjection* projection = (MultiverseProjection*)godProjectIntoMultiverse(god, m);
+    CHECK(projection != NULL);
+    if (projection) {
+        CHECK(projection->universes == m->count);
+        CHECK(projection->entities == entities);
+        CHECK(projection->meanEntropy == entropy / m->count);
+        CHECK(projection->earliestEndOfWorld == earliest);
+    }
+    freeProjection(projection);
+
+    free(evolution);
+    free(single);
+    free(days);
+}
+
+int main(void) {
+    God* god = createGod();
+    CHECK(god != NULL);
+    if (!god) return CHECK_RESULT();
+
+    // Countdowns taken one by one and in bulk see the same instant
+    divineClockUse(DIVINE_CLOCK_FIXED);
+    divineClockSetFixed(2000000000);
+
+    testAddAndRemove();
+    testEmptyProjection(god);
+
+    Multiverse* m = createVariedMultiverse(god);
+    DivineScheduler* s = createDivineScheduler(4);
+    CHECK(m && m->count == UNIVERSES && s);
+    if (m && m->count == UNIVERSES && s) {
+        testBulkMatchesSingle(god, m, NULL);
+        testBulkMatchesSingle(god, m, s);
+
+        // Still in step after removals reorder the registry
+        for (int i = 0; i < 100; i++) freeUniverse(multiverseRemove(m, (i * 37) % m->count));
+        testBulkMatchesSingle(god, m, s);
+    }
+
+    freeDivineScheduler(s);
+    freeMultiverse(m);
+    freeGod(god);
+    divineClockUse(DIVINE_CLOCK_REALTIME);
+    return CHECK_RESULT();
+}
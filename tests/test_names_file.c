@@ -0,0 +1,175 @@
+/**
+ * test_names_file.c - Tests of bulk entity creation from a names file
+ *
+ * Lines of every length around the 32-byte blocks the SIMD newline scanner
+ * reads are compared against a line-by-line reference. The tests also cover
+ * empty lines, "\r\n" endings, a missing final newline, names at and past
+ * the length limit, files added to an existing population, and lookups of
+ * the loaded names.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "god.h"
+#include "check.h"
+
+#define NAMES_PATH "test_names_file.txt"
+#define RANDOM_LINES 5000
+
+static bool writeNamesFile(const char* text, size_t length) {
+    FILE* out = fopen(NAMES_PATH, "wb");
+    if (!out) return false;
+    bool written = fwrite(text, 1, length, out) == length;
+    return fclose(out) == 0 && written;
+}
+
+/**
+ * Check that entities [first, u->numEntities) are the names in `text`,
+ * split the way the loader documents, in order
+ */
+static void checkLoadedNames(const Universe* u, int first, const char* text, size_t length) {
+    int row = first;
+    int wrong = 0;
+    const char* end = text + length;
+    for (const char* line = text; line < end; ) {
+        const char* newline = memchr(line, '\n', (size_t)(end - line));
+        if (!newline) newline = end;
+        size_t nameLength = (size_t)(newline - line);
+        if (nameLength > 0 && line[nameLength - 1] == '\r') nameLength--;
+
+        if (nameLength > 0 && nameLength < MAX_NAME_LENGTH) {
+            const ConsciousEntity* e = row < u->numEntities ? u->consciousEntities[row] : NULL;
+            wrong += !e || e->uniqueId != row + 1 || strlen(e->name) != nameLength ||
+                     memcmp(e->name, line, nameLength) != 0;
+            row++;
+        }
+        line = newline + 1;
+    }
+    CHECK(wrong == 0);
+    CHECK(row == u->numEntities);
+}
+
+static void testLineEndings(God* god) {
+    static const char text[] = "Adam\nEve\r\n\n\r\nCain and Abel\nSeth";
+    CHECK(writeNamesFile(text, sizeof(text) - 1));
+
+    Universe* u = divineCreateUniverse();
+    CHECK(createConsciousEntitiesFromFile(god, u, NAMES_PATH) == 4);
+    checkLoadedNames(u, 0, text, sizeof(text) - 1);
+    CHECK(findConsciousEntity(u, "Eve") == u->consciousEntities[1]);
+    CHECK(findConsciousEntity(u, "Seth") == u->consciousEntities[3]);
+    CHECK(findConsciousEntity(u, "Eve\r") == NULL);
+
+    // A second file continues the ids; a repeated name still finds the first
+    static const char more[] = "Enoch\nAdam\n";
+    CHECK(writeNamesFile(more, sizeof(more) - 1));
+    CHECK(createConsciousEntitiesFromFile(god, u, NAMES_PATH) == 2);
+    checkLoadedNames(u, 4, more, sizeof(more) - 1);
+    CHECK(findConsciousEntity(u, "Enoch") == u->consciousEntities[4]);
+    CHECK(findConsciousEntity(u, "Adam") == u->consciousEntities[0]);
+
+    // Creation one at a time goes on from there
+    char name[] = "Noah";
+    ConsciousEntity* noah = createConsciousEntity(god, u, name);
+    CHECK(noah && noah->uniqueId == 7 && findConsciousEntity(u, "Noah") == noah);
+
+    freeUniverse(u);
+}
+
+static void testNameLengths(God* god) {
+    // Names of MAX_NAME_LENGTH - 1 bytes are kept, longer ones skipped
+    size_t length = 3 * (MAX_NAME_LENGTH + 1) + 2;
+    char* text = (char*)malloc(length);
+    CHECK(text != NULL);
+    if (!text) return;
+
+    char* cursor = text;
+    memset(cursor, 'a', MAX_NAME_LENGTH - 1);
+    cursor += MAX_NAME_LENGTH - 1;
+    *cursor++ = '\n';
+    memset(cursor, 'b', MAX_NAME_LENGTH);
+    cursor += MAX_NAME_LENGTH;
+    *cursor++ = '\n';
+    memset(cursor, 'c', MAX_NAME_LENGTH - 1);
+    cursor += MAX_NAME_LENGTH - 1;
+    *cursor++ = '\r'; // Dropped, so the name fits
+    *cursor++ = '\n';
+    *cursor++ = 'd';
+    length = (size_t)(cursor - text);
+    CHECK(writeNamesFile(text, length));
+
+    Universe* u = divineCreateUniverse();
+    CHECK(createConsciousEntitiesFromFile(god, u, NAMES_PATH) == 3);
+    checkLoadedNames(u, 0, text, length);
+
+    freeUniverse(u);
+    free(text);
+}
+
+static void testRandomLines(God* god) {
+    // Names of 0 to 80 bytes, some with "\r\n", so newlines fall at every
+    // offset of the 32-byte blocks
+    size_t capacity = (size_t)RANDOM_LINES * 83;
+    char* text = (char*)malloc(capacity);
+    CHECK(text != NULL);
+    if (!text) return;
+
+    srand(2024);
+    size_t length = 0;
+    for (int i = 0; i < RANDOM_LINES; i++) {
+        int nameLength = rand() % 81;
+        for (int k = 0; k < nameLength; k++) text[length++] = (char)('a' + (i + k) % 26);
+        if (rand() % 4 == 0) text[length++] = '\r';
+        text[length++] = '\n';
+    }
+    CHECK(writeNamesFile(text, length));
+
+    Universe* u = divineCreateUniverse();
+    char name[] = "First";
+    CHECK(createConsciousEntity(god, u, name) != NULL);
+    int created = createConsciousEntitiesFromFile(god, u, NAMES_PATH);
+    CHECK(created > 0 && created == u->numEntities - 1);
+    checkLoadedNames(u, 1, text, length);
+
+    // Every loaded name is found, as the first entity of that name
+    int wrong = 0;
+    for (int row = 1; row < u->numEntities; row++) {
+        const ConsciousEntity* found = findConsciousEntity(u, u->consciousEntities[row]->name);
+        wrong += !found || strcmp(found->name, u->consciousEntities[row]->name) != 0 ||
+                 found->uniqueId > row + 1;
+    }
+    CHECK(wrong == 0);
+
+    freeUniverse(u);
+    free(text);
+}
+
+static void testUnreadableFiles(God* god) {
+    Universe* u = divineCreateUniverse();
+    CHECK(createConsciousEntitiesFromFile(god, u, "no/such/" NAMES_PATH) == -1);
+    CHECK(createConsciousEntitiesFromFile(NULL, u, NAMES_PATH) == -1);
+
+    CHECK(writeNamesFile("", 0));
+    CHECK(createConsciousEntitiesFromFile(god, u, NAMES_PATH) == 0);
+    CHECK(writeNamesFile("\n\r\n\n", 4));
+    CHECK(createConsciousEntitiesFromFile(god, u, NAMES_PATH) == 0);
+    CHECK(u->numEntities == 0);
+
+    freeUniverse(u);
+}
+
+int main(void) {
+    God* god = createGod();
+    CHECK(god != NULL);
+    if (!god) return CHECK_RESULT();
+
+    testLineEndings(god);
+    testNameLengths(god);
+    testRandomLines(god);
+    testUnreadableFiles(god);
+
+    remove(NAMES_PATH);
+    freeGod(god);
+    return CHECK_RESULT();
+}
@@ -0,0 +1,210 @@
+/**
+ * test_prayer_intents.c - Tests of the prayer intent automaton
+ *
+ * Matches are compared against a strstr reference: overlapping phrases,
+ * phrases sharing suffixes (the failure links), phrases ending the prayer,
+ * and both first-byte prefilters - SIMD for tables whose phrases start
+ * with at most 8 distinct bytes, scalar for the rest.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "god.h"
+#include "check.h"
+
+/**
+ * Intents of a table whose phrases occur in `prayer`, found the slow way
+ */
+static uint64_t referenceMatch(const PrayerIntent* intents, int count, const char* prayer) {
+    uint64_t matched = 0;
+    for (int i = 0; i < count; i++) {
+        if (strstr(prayer, intents[i].phrase)) matched |= (uint64_t)1 << i;
+    }
+
+    return matched;
+}
+
+static void checkMatch(const PrayerIntents* table, const PrayerIntent* intents, int count,
+                       const char* prayer) {
+    uint64_t expected = referenceMatch(intents, count, prayer);
+    uint64_t matched = prayerIntentsMatch(table, prayer);
+    if (matched != expected) {
+        fprintf(stderr, "prayer \"%s\": matched %llx, expected %llx\n", prayer,
+                (unsigned long long)matched, (unsigned long long)expected);
+    }
+    CHECK(matched == expected);
+}
+
+static void testOverlappingPhrases(void) {
+    static const PrayerIntent intents[] = {
+        { "he", 0, 1.0 }, { "she", 0, 1.0 }, { "his", 0, 1.0 }, { "hers", 0, 1.0 }
+    };
+    PrayerIntents* table = createPrayerIntents(intents, 4);
+    CHECK(table != NULL);
+    if (!table) return;
+
+    CHECK(prayerIntentsMatch(table, "ushers") == 0xB); // he, she, hers
+    CHECK(prayerIntentsMatch(table, "this") == 0x4);
+    CHECK(prayerIntentsMatch(table, "hhhis") == 0x4);
+    CHECK(prayerIntentsMatch(table, "") == 0);
+
+    static const char* const prayers[] = { "shers", "hishe", "sheshis", "h", "hehehe", "xhersx" };
+    for (size_t i = 0; i < sizeof(prayers) / sizeof(prayers[0]); i++) {
+        checkMatch(table, intents, 4, prayers[i]);
+    }
+    freePrayerIntents(table);
+}
+
+static void testSharedSuffixes(void) {
+    // Each phrase is a suffix of the one before - a miss deep in one
+    // falls back through the failure links to the next
+    static const PrayerIntent intents[] = {
+        { "abcd", 0, 1.0 }, { "bcd", 0, 1.0 }, { "cd", 0, 1.0 }, { "d", 0, 1.0 }, { "abce", 0, 1.0 }
+    };
+    PrayerIntents* table = createPrayerIntents(intents, 5);
+    CHECK(table != NULL);
+    if (!table) return;
+
+    CHECK(prayerIntentsMatch(table, "xabcd") == 0xF);
+    CHECK(prayerIntentsMatch(table, "xbcd") == 0xE);
+    CHECK(prayerIntentsMatch(table, "abcabce") == 0x10);
+    CHECK(prayerIntentsMatch(table, "abcbcd") == 0xE);
+
+    static const char* const prayers[] = { "aabcabcd", "abcdabce", "bcbcbc", "ab", "ccd" };
+    for (size_t i = 0; i < sizeof(prayers) / sizeof(prayers[0]); i++) {
+        checkMatch(table, intents, 5, prayers[i]);
+    }
+    freePrayerIntents(table);
+}
+
+/**
+ * Phrases ending exactly at the end of the prayer, at every length around
+ * the 32-byte blocks the SIMD prefilter scans
+ */
+static void testMatchAtEnd(const PrayerIntent* intents, int count) {
+    PrayerIntents* table = createPrayerIntents(intents, count);
+    CHECK(table != NULL);
+    if (!table) return;
+
+    char prayer[128];
+    for (int length = 0; length < 100; length++) {
+        for (int i = 0; i < count; i++) {
+            size_t phraseLength = strlen(intents[i].phrase);
+            memset(prayer, '.', (size_t)length);
+            memcpy(prayer + length, intents[i].phrase, phraseLength + 1);
+            CHECK(prayerIntentsMatch(table, prayer) & ((uint64_t)1 << i));
+            checkMatch(table, intents, count, prayer);
+        }
+    }
+    freePrayerIntents(table);
+}
+
+/**
+ * Random prayers over a small alphabet, so phrases occur often and partly
+ */
+static void testRandomPrayers(const PrayerIntent* intents, int count, const char* alphabet) {
+    PrayerIntents* table = createPrayerIntents(intents, count);
+    CHECK(table != NULL);
+    if (!table) return;
+
+    srand(12345);
+    size_t letters = strlen(alphabet);
+    char prayer[256];
+    for (int round = 0; round < 20000; round++) {
+        int length = rand() % (int)(sizeof(prayer) - 1);
+        for (int i = 0; i < length; i++) prayer[i] = alphabet[rand() % (int)letters];
+        prayer[length] = '\0';
+        checkMatch(table, intents, count, prayer);
+    }
+    freePrayerIntents(table);
+}
+
+/* Phrases starting with 3 distinct bytes - the SIMD prefilter where the CPU has it */
+static const PrayerIntent fewFirstBytes[] = {
+    { "guide me", 0, 1.0 }, { "grant", 0, 1.0 }, { "mercy", 0, 1.0 }, { "me", 0, 1.0 },
+    { "rant", 0, 1.0 }
+};
+
+/* Phrases starting with 10 distinct bytes - always the scalar prefilter */
+static const PrayerIntent manyFirstBytes[] = {
+    { "ab", 0, 1.0 }, { "bc", 0, 1.0 }, { "cde", 0, 1.0 }, { "dd", 0, 1.0 }, { "ea", 0, 1.0 },
+    { "fab", 0, 1.0 }, { "gg", 0, 1.0 }, { "hi", 0, 1.0 }, { "ic", 0, 1.0 }, { "jab", 0, 1.0 }
+};
+
+static void testBatchResponse(void) {
+    static const PrayerIntent intents[] = {
+        { "a", 2, 0.9 }, { "b", -1, 1.1 }, { "ab", 3, 0.7 }
+    };
+    PrayerIntents* table = createPrayerIntents(intents, 3);
+    God* god = createGod();
+    Universe* u = divineCreateUniverse();
+    char name[] = "Adam";
+    ConsciousEntity* entity = god && u ? createConsciousEntity(god, u, name) : NULL;
+    CHECK(table && entity);
+    if (!table || !entity) return;
+
+    static const char* const prayers[] = { "ab", "b", NULL, "xaxb", "ab ab", "zzz", "bab" };
+    const int count = (int)(sizeof(prayers) / sizeof(prayers[0]));
+    PrayerRequest requests[sizeof(prayers) / sizeof(prayers[0])];
+    for (int i = 0; i < count; i++) {
+        requests[i].pray_er = entity;
+        requests[i].prayer = prayers[i];
+    }
+
+    // One miracle, then each prayer's adjustments in turn
+    Universe* single = prayerIntentsRespond(table, entity, "", u);
+    CHECK(single != NULL);
+    long lifespan = single ? single->totalLifespanDays - 1 : 0;
+    double entropy = single ? single->entropyLevel : 0.0;
+    for (int i = 0; i < count; i++) {
+        if (!prayers[i]) continue;
+
+        lifespan += 1;
+        uint64_t matched = prayerIntentsMatch(table, prayers[i]);
+        for (int k = 0; k < 3; k++) {
+            if (!(matched & ((uint64_t)1 << k))) continue;
+            lifespan += intents[k].lifespanDays;
+            entropy *= intents[k].entropyFactor;
+        }
+    }
+
+    Universe* batch = prayerIntentsRespondBatch(table, requests, count, u);
+    CHECK(batch != NULL);
+    if (batch) {
+        CHECK(batch->totalLifespanDays == lifespan);
+        CHECK(batch->entropyLevel == entropy);
+    }
+
+    PrayerRequest none = { NULL, "ab" };
+    CHECK(prayerIntentsRespondBatch(table, &none, 1, u) == NULL);
+
+    freeUniverse(batch);
+    freeUniverse(single);
+    freeUniverse(u);
+    freeGod(god);
+    freePrayerIntents(table);
+}
+
+static void testInvalidTables(void) {
+    static const PrayerIntent empty[] = { { "", 0, 1.0 } };
+    static const PrayerIntent missing[] = { { NULL, 0, 1.0 } };
+    CHECK(createPrayerIntents(empty, 1) == NULL);
+    CHECK(createPrayerIntents(missing, 1) == NULL);
+    CHECK(createPrayerIntents(fewFirstBytes, 0) == NULL);
+    CHECK(createPrayerIntents(fewFirstBytes, MAX_PRAYER_INTENTS + 1) == NULL);
+    CHECK(prayerIntentsMatch(NULL, "guide me") == 0);
+}
+
+int main(void) {
+    testOverlappingPhrases();
+    testSharedSuffixes();
+    testMatchAtEnd(fewFirstBytes, 5);
+    testMatchAtEnd(manyFirstBytes, 10);
+    testRandomPrayers(fewFirstBytes, 5, "guide mrantcy");
+    testRandomPrayers(manyFirstBytes, 10, "abcdefghij");
+    testBatchResponse();
+    testInvalidTables();
+
+    return CHECK_RESULT();
+}
@@ -0,0 +1,156 @@
+/**
+ * test_prayer_queue.c - Tests of the lock-free prayer queue
+ *
+ * Capacity rounding, drops when full, first-in first-out draining in
+ * limited and unlimited drains, and many producers submitting while the
+ * consumer drains - every accepted prayer answered exactly once.
+ */
+
+#define _POSIX_C_SOURCE 200809L // sched_yield
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "god.h"
+#include "check.h"
+
+#define PRODUCERS 4
+#define PRAYERS_PER_PRODUCER 20000
+
+static const char prayers[PRODUCERS * PRAYERS_PER_PRODUCER]; // One distinct address per prayer
+
+/* Prayers seen by an answered callback, in order */
+typedef struct Answers {
+    const char* seen[64];
+    int count;
+    int unanswered; // Responses that came back NULL
+} Answers;
+
+static void recordAnswer(void* context, const PrayerRequest* request, Universe* response) {
+    Answers* answers = (Answers*)context;
+    if (answers->count < 64) answers->seen[answers->count] = request->prayer;
+    answers->count++;
+    if (!response) answers->unanswered++;
+    freeUniverse(response);
+}
+
+static void testCapacityAndOrder(God* god, const Universe* u, const ConsciousEntity* entity) {
+    CHECK(createPrayerQueue(0) == NULL);
+
+    PrayerQueue* q = createPrayerQueue(5); // Rounded up to 8
+    CHECK(q != NULL);
+    if (!q) return;
+
+    for (int i = 0; i < 8; i++) CHECK(prayerQueueSubmit(q, entity, &prayers[i]));
+    CHECK(!prayerQueueSubmit(q, entity, &prayers[8]));
+    CHECK(prayerQueueDropped(q) == 1);
+    CHECK(prayerQueueDepth(q) == 8);
+    CHECK(!prayerQueueSubmit(q, NULL, &prayers[8]));
+    CHECK(!prayerQueueSubmit(q, entity, NULL));
+
+    // A limited drain takes the oldest prayers and frees their slots
+    Answers answers = { { 0 }, 0, 0 };
+    CHECK(prayerQueueDrain(q, god, u, 3, &recordAnswer, &answers) == 3);
+    CHECK(prayerQueueDepth(q) == 5);
+    for (int i = 8; i < 11; i++) CHECK(prayerQueueSubmit(q, entity, &prayers[i]));
+    CHECK(prayerQueueDepth(q) == 8);
+
+    // An unlimited drain empties the queue, wrapping around the slots in order
+    CHECK(prayerQueueDrain(q, god, u, 0, &recordAnswer, &answers) == 8);
+    CHECK(answers.count == 11);
+    CHECK(answers.unanswered == 0);
+    for (int i = 0; i < 11; i++) CHECK(answers.seen[i] == &prayers[i]);
+    CHECK(prayerQueueDepth(q) == 0);
+    CHECK(prayerQueueDrain(q, god, u, 0, NULL, NULL) == 0);
+    CHECK(prayerQueueDropped(q) == 1);
+
+    freePrayerQueue(q);
+}
+
+/* One producer's share of the concurrent test */
+typedef struct Producer {
+    PrayerQueue* queue;
+    const ConsciousEntity* entity;
+    int first;          // Index of its first prayer
+    int submitted;
+} Producer;
+
+static void* produce(void* argument) {
+    Producer* producer = (Producer*)argument;
+    for (int i = 0; i < PRAYERS_PER_PRODUCER; i++) {
+        // Retry until accepted, so every prayer goes through once
+        while (!prayerQueueSubmit(producer->queue, producer->entity, &prayers[producer->first + i])) {
+            sched_yield();
+        }
+        producer->submitted++;
+    }
+
+    return NULL;
+}
+
+/* Per-prayer answer counts of the concurrent test */
+typedef struct Tally {
+    unsigned char* answered;
+    int total;
+    int lastSeen[PRODUCERS]; // Last prayer of each producer answered, to check its order
+    bool ordered;
+} Tally;
+
+static void tallyAnswer(void* context, const PrayerRequest* request, Universe* response) {
+    Tally* tally = (Tally*)context;
+    int index = (int)(request->prayer - prayers);
+    int producer = index / PRAYERS_PER_PRODUCER;
+    if (index <= tally->lastSeen[producer]) tally->ordered = false;
+    tally->lastSeen[producer] = index;
+    tally->answered[index]++;
+    tally->total++;
+    freeUniverse(response);
+}
+
+static void testConcurrentProducers(God* god, const Universe* u, const ConsciousEntity* entity) {
+    PrayerQueue* q = createPrayerQueue(256);
+    Tally tally = { (unsigned char*)calloc(PRODUCERS * PRAYERS_PER_PRODUCER, 1), 0, { 0 }, true };
+    CHECK(q && tally.answered);
+    if (!q || !tally.answered) return;
+    for (int p = 0; p < PRODUCERS; p++) tally.lastSeen[p] = p * PRAYERS_PER_PRODUCER - 1;
+
+    pthread_t threads[PRODUCERS];
+    Producer producers[PRODUCERS];
+    for (int p = 0; p < PRODUCERS; p++) {
+        producers[p] = (Producer){ q, entity, p * PRAYERS_PER_PRODUCER, 0 };
+        CHECK(pthread_create(&threads[p], NULL, &produce, &producers[p]) == 0);
+    }
+
+    // Drain while the producers run, until every prayer is in
+    while (tally.total < PRODUCERS * PRAYERS_PER_PRODUCER) {
+        if (prayerQueueDrain(q, god, u, 0, &tallyAnswer, &tally) == 0) sched_yield();
+    }
+    for (int p = 0; p < PRODUCERS; p++) pthread_join(threads[p], NULL);
+
+    CHECK(tally.total == PRODUCERS * PRAYERS_PER_PRODUCER);
+    CHECK(tally.ordered);
+    int once = 0;
+    for (int i = 0; i < PRODUCERS * PRAYERS_PER_PRODUCER; i++) once += tally.answered[i] == 1;
+    CHECK(once == PRODUCERS * PRAYERS_PER_PRODUCER);
+    CHECK(prayerQueueDepth(q) == 0);
+
+    free(tally.answered);
+    freePrayerQueue(q);
+}
+
+int main(void) {
+    God* god = createGod();
+    Universe* u = divineCreateUniverse();
+    char name[] = "Abel";
+    ConsciousEntity* entity = god && u ? createConsciousEntity(god, u, name) : NULL;
+    CHECK(entity != NULL);
+    if (!entity) return CHECK_RESULT();
+
+    testCapacityAndOrder(god, u, entity);
+    testConcurrentProducers(god, u, entity);
+
+    freeUniverse(u);
+    freeGod(god);
+    return CHECK_RESULT();
+}
@@ -0,0 +1,156 @@
+/**
+ * test_scheduler.c - Tests of the work-stealing scheduler
+ *
+ * divineParallelFor must run every index of its range exactly once, for
+ * empty, single, odd and large ranges, any grain, on the caller (NULL),
+ * one worker and many. divinePrayerSweep must answer each entity as a
+ * serial loop of prayers and choices would, through the built-in response
+ * and through a God with its own.
+ */
+
+#include <stdlib.h>
+
+#include "god.h"
+#include "check.h"
+
+#define LARGE_RANGE (1 << 20)
+#define OFFSET 17          // Ranges start here, so subranges are not mistaken for indices
+#define SWEEP_ENTITIES 1000
+
+/* Per-index run counts of one divineParallelFor */
+typedef struct Coverage {
+    int begin;
+    int end;
+    int* runs;       // runs[i - begin] for index i
+    int outside;     // Subranges empty or reaching outside [begin, end)
+} Coverage;
+
+static void countRuns(void* context, int begin, int end) {
+    Coverage* coverage = (Coverage*)context;
+    if (begin >= end || begin < coverage->begin || end > coverage->end) {
+        __atomic_add_fetch(&coverage->outside, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    for (int i = begin; i < end; i++) {
+        __atomic_add_fetch(&coverage->runs[i - coverage->begin], 1, __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * Whether divineParallelFor runs each of `n` indices exactly once
+ */
+static bool coversOnce(DivineScheduler* s, int n, int grain) {
+    Coverage coverage = { OFFSET, OFFSET + n, (int*)calloc((size_t)n + 1, sizeof(int)), 0 };
+    if (!coverage.runs) return false;
+
+    divineParallelFor(s, coverage.begin, coverage.end, grain, &countRuns, &coverage);
+
+    bool once = coverage.outside == 0;
+    for (int i = 0; i < n; i++) once = once && coverage.runs[i] == 1;
+    free(coverage.runs);
+    return once;
+}
+
+static void testCoverage(DivineScheduler* s) {
+    static const int sizes[] = { 0, 1, 1001, LARGE_RANGE };
+    static const int grains[] = { 0, 1, 7, 256, LARGE_RANGE * 2 };
+
+    for (size_t n = 0; n < sizeof(sizes) / sizeof(sizes[0]); n++) {
+        for (size_t g = 0; g < sizeof(grains) / sizeof(grains[0]); g++) {
+            bool once = coversOnce(s, sizes[n], grains[g]);
+            if (!once) {
+                fprintf(stderr, "%d threads, %d indices, grain %d: not each run once\n",
+                        divineSchedulerThreads(s), sizes[n], grains[g]);
+            }
+            CHECK(once);
+        }
+    }
+
+    // A reversed range runs nothing
+    Coverage reversed = { 0, 0, NULL, 0 };
+    divineParallelFor(s, 10, 5, 1, &countRuns, &reversed);
+    CHECK(reversed.outside == 0);
+}
+
+/**
+ * Respond as the built-in response does, through a pointer of its own so
+ * the sweep takes its general path
+ */
+static Universe* ownResponse(const ConsciousEntity* pray_er, const char* prayer, const Universe* u) {
+    return divinePrayerResponse(pray_er, prayer, u);
+}
+
+static void testPrayerSweep(God* god, const Universe* u, DivineScheduler* s) {
+    PrayerOutcome* outcomes = (PrayerOutcome*)malloc(sizeof(PrayerOutcome) * SWEEP_ENTITIES);
+    CHECK(outcomes != NULL);
+    if (!outcomes) return;
+
+    CHECK(divinePrayerSweep(s, god, u, outcomes));
+
+    int different = 0;
+    for (int i = 0; i < u->numEntities; i++) {
+        ConsciousEntity* entity = u->consciousEntities[i];
+        char* prayer = entity->formPrayer(entity);
+        Universe* expected = god->respondToPrayer(entity, prayer, u);
+        State options = { expected, NULL, expected != NULL };
+        bool choice = entity->makeChoice(&options);
+
+        const Universe* response = outcomes[i].response;
+        different += !expected || !response || outcomes[i].choice != choice ||
+                     response->entropyLevel != expected->entropyLevel ||
+                     response->totalLifespanDays != expected->totalLifespanDays ||
+                     response->numConstants != expected->numConstants;
+
+        freeUniverse(expected);
+        free(prayer);
+        freeUniverse(outcomes[i].response);
+    }
+    if (different > 0) {
+        fprintf(stderr, "%d threads: %d sweep outcomes differ from the serial loop\n",
+                divineSchedulerThreads(s), different);
+    }
+    CHECK(different == 0);
+
+    free(outcomes);
+}
+
+int main(void) {
+    God* god = createGod();
+    Universe* u = divineCreateUniverse();
+    CHECK(god && u);
+    if (!god || !u) return CHECK_RESULT();
+
+    // Names that do and do not ask for guidance, so responses differ
+    divineClockUse(DIVINE_CLOCK_FIXED);
+    divineClockSetFixed(1000000000);
+    char name[32];
+    for (int i = 0; i < SWEEP_ENTITIES; i++) {
+        snprintf(name, sizeof(name), i % 3 == 0 ? "guide me %d" : "Entity%d", i);
+        CHECK(createConsciousEntity(god, u, name) != NULL);
+    }
+
+    DivineScheduler* schedulers[] = { NULL, createDivineScheduler(1), createDivineScheduler(4) };
+    CHECK(schedulers[1] && schedulers[2]);
+    CHECK(divineSchedulerThreads(schedulers[2]) == 4);
+
+    God* own = createGod();
+    CHECK(own != NULL);
+    if (own) own->respondToPrayer = &ownResponse;
+
+    for (int k = 0; k < 3; k++) {
+        if (k > 0 && !schedulers[k]) continue;
+        testCoverage(schedulers[k]);
+        testPrayerSweep(god, u, schedulers[k]);
+        if (own) testPrayerSweep(own, u, schedulers[k]);
+    }
+
+    CHECK(!divinePrayerSweep(NULL, NULL, u, NULL));
+
+    freeGod(own);
+    freeDivineScheduler(schedulers[1]);
+    freeDivineScheduler(schedulers[2]);
+    freeUniverse(u);
+    freeGod(god);
+    divineClockUse(DIVINE_CLOCK_REALTIME);
+    return CHECK_RESULT();
+}
@@ -0,0 +1,168 @@
+/**
+ * test_simd_parity.c - Tests of the SIMD kernels against the scalar path
+ *
+ * The AVX2 evolution kernel and the AVX2 and AVX-512 end-of-world kernels
+ * must give exactly the scalar results, for every length around their
+ * vector widths and on inputs and outputs off vector alignment. Each kernel
+ * is called directly rather than through the runtime selection, so every
+ * kernel the CPU supports is checked; the others are skipped.
+ *
+ * Built from god.c itself rather than against libgod, to reach the kernels.
+ */
+
+#include "../god.c"
+#include "check.h"
+
+#define MAX_POINTS 67  // Past several AVX2 vectors, ending partway into one
+#define UNIVERSES 61   // Several end-of-world blocks, the last one partial
+#define GUARD -12345.0 // Written past the end of outputs, which must keep it
+
+/**
+ * Whether an evolution kernel matches universeEvolveFunction at every
+ * length up to MAX_POINTS, from time points and into outputs at `offset`
+ * elements into their arrays
+ */
+static bool evolveMatches(EvolveBatchKernel kernel, int offset) {
+    TimePoint points[MAX_POINTS + 2];
+    double evolution[MAX_POINTS + 3];
+    for (int i = 0; i < MAX_POINTS + 2; i++) {
+        points[i].temporalCoordinate = (i % 2 ? -1.0 : 1.0) * (i * 1.37 + 0.001) * (i % 5 == 0 ? 1e300 : 1.0);
+        points[i].isInEternity = i % 3 == 0;
+    }
+
+    int wrong = 0;
+    for (int count = 0; count <= MAX_POINTS; count++) {
+        for (int i = 0; i < MAX_POINTS + 3; i++) evolution[i] = GUARD;
+        kernel(points + offset, count, evolution + offset);
+
+        for (int i = 0; i < count; i++) {
+            wrong += evolution[offset + i] != universeEvolveFunction(&points[offset + i]);
+        }
+        for (int i = 0; i < offset; i++) wrong += evolution[i] != GUARD;
+        wrong += evolution[offset + count] != GUARD;
+    }
+
+    return wrong == 0;
+}
+
+static void testEvolve(void) {
+    for (int offset = 0; offset < 2; offset++) {
+        CHECK(evolveMatches(&universeEvolveBatchScalar, offset));
+#if GOD_X86_SIMD
+        if (__builtin_cpu_supports("avx2")) CHECK(evolveMatches(&universeEvolveBatchAvx2, offset));
+#endif
+        CHECK(evolveMatches(&universeEvolveBatchFunction, offset));
+    }
+#if GOD_X86_SIMD
+    if (!__builtin_cpu_supports("avx2")) fprintf(stderr, "no AVX2 - evolution kernel skipped\n");
+#endif
+
+    // Stepping generates its time points a batch at a time; a history ending
+    // partway into the third batch crosses both boundaries
+    Universe* u = divineCreateUniverse();
+    int steps = 2 * EVOLVE_BATCH + 3;
+    double* evolution = (double*)malloc(sizeof(double) * (size_t)steps);
+    CHECK(u && evolution && universeEvolveSteps(u, -3.0, 0.7, steps, evolution));
+    if (u && evolution) {
+        int wrong = 0;
+        for (int k = 0; k < steps; k++) {
+            TimePoint t = { -3.0 + k * 0.7, false };
+            wrong += evolution[k] != universeEvolveFunction(&t);
+        }
+        CHECK(wrong == 0);
+    }
+    free(evolution);
+    freeUniverse(u);
+}
+
+/**
+ * Universes covering each clamp of the end-of-world calculation - lifespans
+ * already over, entropy past its maximum or NaN, changed constants, large
+ * populations - with NULL among them
+ */
+static void createVariedUniverses(God* god, Universe** universes, time_t now) {
+    char name[32];
+    for (int i = 0; i < UNIVERSES; i++) {
+        if (i % 13 == 6) {
+            universes[i] = NULL;
+            continue;
+        }
+        Universe* u = divineCreateUniverse();
+        universes[i] = u;
+        if (!u) continue;
+
+        u->creationTime = now - (time_t)(i % 9) * 400 * 86400;
+        u->totalLifespanDays = 200L + 811L * (i % 17);
+        u->entropyLevel = (i % 23) / 11.0;
+        u->maxEntropy = 0.5 + (i % 3);
+        if (i % 19 == 4) u->entropyLevel = NAN;
+        if (i % 4 == 1) universeSetConstant(u, 1 + i % 7, 1e3 * i);
+        if (i % 6 == 2) universeResizeConstants(u, 3 + i % 40);
+        // Past 8100 entities the moral dimension stops growing
+        int entities = i == 3 ? 8200 : i % 10 == 3 ? 300 : i % 3;
+        if (!reserveEntities(u, entities)) continue;
+        for (int k = 0; k < entities; k++) {
+            snprintf(name, sizeof(name), "Entity%d.%d", i, k);
+            createConsciousEntity(god, u, name);
+        }
+    }
+}
+
+/**
+ * Whether an end-of-world kernel matches calculateEndOfWorldAt for every
+ * count of universes, starting `offset` universes in and writing `offset`
+ * elements into the output
+ */
+static bool eschatologyMatches(EschatologyKernel kernel, Universe* const* universes, time_t now, int offset) {
+    long days[UNIVERSES + 2];
+
+    int wrong = 0;
+    for (int count = 0; count <= UNIVERSES - offset; count++) {
+        for (int i = 0; i < UNIVERSES + 2; i++) days[i] = LONG_MIN;
+        calculateEndOfWorldBatchWith(kernel, (const Universe* const*)universes + offset, count,
+                                     days + offset, now);
+
+        for (int i = 0; i < count; i++) {
+            wrong += days[offset + i] != calculateEndOfWorldAt(universes[offset + i], now);
+        }
+        for (int i = 0; i < offset; i++) wrong += days[i] != LONG_MIN;
+        wrong += days[offset + count] != LONG_MIN;
+    }
+
+    return wrong == 0;
+}
+
+static void testEschatology(God* god) {
+    time_t now = 1700000000;
+    Universe* universes[UNIVERSES];
+    createVariedUniverses(god, universes, now);
+
+    for (int offset = 0; offset < 2; offset++) {
+        CHECK(eschatologyMatches(NULL, universes, now, offset));
+#if GOD_X86_SIMD
+        if (__builtin_cpu_supports("avx2")) CHECK(eschatologyMatches(&eschatologyKernelAvx2, universes, now, offset));
+        if (__builtin_cpu_supports("avx512f")) CHECK(eschatologyMatches(&eschatologyKernelAvx512, universes, now, offset));
+#endif
+        CHECK(eschatologyMatches(selectEschatologyKernel(), universes, now, offset));
+    }
+#if GOD_X86_SIMD
+    if (!__builtin_cpu_supports("avx512f")) fprintf(stderr, "no AVX-512 - its end-of-world kernel skipped\n");
+#endif
+
+    for (int i = 0; i < UNIVERSES; i++) freeUniverse(universes[i]);
+}
+
+int main(void) {
+    God* god = createGod();
+    CHECK(god != NULL);
+    if (!god) return CHECK_RESULT();
+#if GOD_X86_SIMD
+    __builtin_cpu_init();
+#endif
+
+    testEvolve();
+    testEschatology(god);
+
+    freeGod(god);
+    return CHECK_RESULT();
+}
@@ -0,0 +1,220 @@
+/**
+ * test_snapshot.c - Tests of universe snapshots
+ *
+ * Save and load round trips, on the caller and on a scheduler, lookups
+ * through the mapped name index, copy-on-write attribute writes, growth
+ * after a load, and rejection of damaged files.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "god.h"
+#include "check.h"
+
+#define SNAPSHOT_PATH "test_snapshot.snap"
+#define DAMAGED_PATH "test_snapshot_damaged.snap"
+#define ENTITIES 1000
+#define INDEX_BYTES (2048 * 8) // Name index of ENTITIES names, the last section of the file
+
+static Universe* createPopulatedUniverse(God* god) {
+    Universe* u = divineCreateUniverse();
+    if (!u || !reserveEntities(u, ENTITIES)) return u;
+
+    universeResizeConstants(u, 40);
+    universeSetConstant(u, 3, 42.0);
+    u->entropyLevel = 0.3;
+
+    char name[32];
+    for (int i = 0; i < ENTITIES; i++) {
+        snprintf(name, sizeof(name), "Entity%d", i);
+        ConsciousEntity* entity = createConsciousEntity(god, u, name);
+        if (entity) *(double*)entity->consciousness = 1.0 / (i + 1);
+    }
+
+    return u;
+}
+
+static void checkSameUniverse(const Universe* saved, const Universe* loaded) {
+    CHECK(loaded->numEntities == saved->numEntities);
+    CHECK(loaded->numConstants == saved->numConstants);
+    CHECK(loaded->physicalConstants[3] == 42.0);
+    CHECK(loaded->entropyLevel == saved->entropyLevel);
+    CHECK(loaded->creationTime == saved->creationTime);
+    CHECK(loaded->totalLifespanDays == saved->totalLifespanDays);
+    CHECK(calculateEndOfWorld(loaded) == calculateEndOfWorld(saved));
+    if (loaded->numEntities != saved->numEntities) return;
+
+    int different = 0;
+    for (int i = 0; i < saved->numEntities; i++) {
+        const ConsciousEntity* a = saved->consciousEntities[i];
+        const ConsciousEntity* b = loaded->consciousEntities[i];
+        different += strcmp(a->name, b->name) != 0 || a->uniqueId != b->uniqueId ||
+                     *(double*)a->consciousness != *(double*)b->consciousness ||
+                     *(double*)a->freeWill != *(double*)b->freeWill;
+    }
+    CHECK(different == 0);
+
+    // Lookups go through the index mapped from the file
+    int missing = 0;
+    char name[32];
+    for (int i = 0; i < saved->numEntities; i++) {
+        snprintf(name, sizeof(name), "Entity%d", i);
+        const ConsciousEntity* found = findConsciousEntity(loaded, name);
+        missing += !found || found != loaded->consciousEntities[i];
+    }
+    CHECK(missing == 0);
+    CHECK(findConsciousEntity(loaded, "Nobody") == NULL);
+}
+
+static void testRoundTrip(God* god, const Universe* u, DivineScheduler* s) {
+    Universe* loaded = loadUniverseSnapshot(SNAPSHOT_PATH, s);
+    CHECK(loaded != NULL);
+    if (!loaded) return;
+    checkSameUniverse(u, loaded);
+
+    // Writes stay in memory, the file keeps the saved values
+    *(double*)loaded->consciousEntities[0]->freeWill = 0.5;
+    Universe* again = loadUniverseSnapshot(SNAPSHOT_PATH, s);
+    CHECK(again && *(double*)again->consciousEntities[0]->freeWill ==
+                   *(double*)u->consciousEntities[0]->freeWill);
+    freeUniverse(again);
+
+    // Growing the population moves everything out of the mapping
+    char name[] = "Newcomer";
+    ConsciousEntity* newcomer = createConsciousEntity(god, loaded, name);
+    CHECK(newcomer != NULL);
+    CHECK(loaded->snapshotMapping == NULL);
+    CHECK(findConsciousEntity(loaded, "Newcomer") == newcomer);
+    CHECK(findConsciousEntity(loaded, "Entity999") == loaded->consciousEntities[999]);
+    CHECK(*(double*)loaded->consciousEntities[0]->freeWill == 0.5);
+
+    freeUniverse(loaded);
+}
+
+static void testEmptyUniverse(void) {
+    Universe* empty = divineCreateUniverse();
+    CHECK(empty && saveUniverseSnapshot(empty, SNAPSHOT_PATH));
+
+    Universe* loaded = loadUniverseSnapshot(SNAPSHOT_PATH, NULL);
+    CHECK(loaded && loaded->numEntities == 0);
+    CHECK(loaded && findConsciousEntity(loaded, "Anyone") == NULL);
+
+    freeUniverse(loaded);
+    freeUniverse(empty);
+}
+
+/* Bytes of the saved snapshot, damaged in turn */
+typedef struct SnapshotBytes {
+    unsigned char* data;
+    size_t size;
+} SnapshotBytes;
+
+static SnapshotBytes readSnapshot(const char* path) {
+    SnapshotBytes bytes = { NULL, 0 };
+    FILE* in = fopen(path, "rb");
+    if (!in) return bytes;
+
+    fseek(in, 0, SEEK_END);
+    long size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    bytes.data = size > 0 ? (unsigned char*)malloc((size_t)size) : NULL;
+    if (bytes.data && fread(bytes.data, 1, (size_t)size, in) == (size_t)size) bytes.size = (size_t)size;
+    fclose(in);
+
+    return bytes;
+}
+
+/**
+ * Whether a snapshot of `size` bytes from `data` is rejected
+ */
+static bool rejected(const unsigned char* data, size_t size) {
+    FILE* out = fopen(DAMAGED_PATH, "wb");
+    if (!out) return false;
+    bool written = fwrite(data, 1, size, out) == size;
+    written = fclose(out) == 0 && written;
+
+    Universe* loaded = written ? loadUniverseSnapshot(DAMAGED_PATH, NULL) : NULL;
+    freeUniverse(loaded);
+    return written && loaded == NULL;
+}
+
+static void testDamagedFiles(void) {
+    SnapshotBytes bytes = readSnapshot(SNAPSHOT_PATH);
+    CHECK(bytes.size > INDEX_BYTES);
+    if (bytes.size <= INDEX_BYTES) {
+        free(bytes.data);
+        return;
+    }
+    unsigned char* damaged = (unsigned char*)malloc(bytes.size + 1);
+    CHECK(damaged != NULL);
+    if (!damaged) return;
+
+    CHECK(loadUniverseSnapshot("no/such/" SNAPSHOT_PATH, NULL) == NULL);
+    CHECK(!saveUniverseSnapshot(NULL, SNAPSHOT_PATH));
+    CHECK(rejected(bytes.data, 0));
+    CHECK(rejected(bytes.data, 16));
+    CHECK(rejected(bytes.data, bytes.size - 1)); // Truncated
+
+    memcpy(damaged, bytes.data, bytes.size);
+    damaged[bytes.size] = 0;
+    CHECK(rejected(damaged, bytes.size + 1)); // Trailing garbage
+
+    memcpy(damaged, bytes.data, bytes.size);
+    damaged[0] ^= 0xFF; // Magic
+    CHECK(rejected(damaged, bytes.size));
+
+    memcpy(damaged, bytes.data, bytes.size);
+    damaged[8] ^= 0xFF; // Version
+    CHECK(rejected(damaged, bytes.size));
+
+    // The index holds one slot per name
+    memcpy(damaged, bytes.data, bytes.size);
+    unsigned char* index = damaged + bytes.size - INDEX_BYTES;
+    int used = 0;
+    for (size_t slot = 0; slot < INDEX_BYTES / sizeof(uint64_t); slot++) {
+        uint64_t entry;
+        memcpy(&entry, index + slot * sizeof(uint64_t), sizeof(entry));
+        used += entry != 0;
+    }
+    CHECK(used == ENTITIES);
+
+    // An index slot naming a row past the table
+    uint64_t outside = ((uint64_t)1 << 32) | (uint64_t)(ENTITIES + 1);
+    memcpy(index, &outside, sizeof(outside));
+    CHECK(rejected(damaged, bytes.size));
+
+    // An index without a free slot, which would never end a failed lookup
+    uint64_t inside = ((uint64_t)1 << 32) | 1;
+    for (size_t slot = 0; slot < INDEX_BYTES / sizeof(uint64_t); slot++) {
+        memcpy(index + slot * sizeof(uint64_t), &inside, sizeof(inside));
+    }
+    CHECK(rejected(damaged, bytes.size));
+
+    // The undamaged bytes still load
+    CHECK(!rejected(bytes.data, bytes.size));
+
+    remove(DAMAGED_PATH);
+    free(damaged);
+    free(bytes.data);
+}
+
+int main(void) {
+    God* god = createGod();
+    Universe* u = god ? createPopulatedUniverse(god) : NULL;
+    DivineScheduler* s = createDivineScheduler(4);
+    CHECK(u && u->numEntities == ENTITIES && s);
+    if (!u || u->numEntities != ENTITIES || !s) return CHECK_RESULT();
+
+    CHECK(saveUniverseSnapshot(u, SNAPSHOT_PATH));
+    testRoundTrip(god, u, NULL);
+    testRoundTrip(god, u, s);
+    testDamagedFiles();
+    testEmptyUniverse();
+
+    remove(SNAPSHOT_PATH);
+    freeDivineScheduler(s);
+    freeUniverse(u);
+    freeGod(god);
+    return CHECK_RESULT();
+}
@@ -0,0 +1,117 @@
+/**
+ * test_template_prayers.c - Tests of template prayers
+ *
+ * A template prayer must ask for exactly the intents of its rendered text,
+ * including intents inside the entity's name and phrases spanning the
+ * boundary between the name and the template.
+ */
+
+#include <string.h>
+
+#include "god.h"
+#include "check.h"
+
+/* Phrases inside names, across "Prayer from <name>: Please guide me." and
+ * in the template alone */
+static const PrayerIntent intents[] = {
+    { "guide me", 1, 0.9 },  // In the template and in some names
+    { "from Bo", 2, 1.1 },   // Prefix into the name
+    { "ob: Ple", 3, 0.7 },   // Name into the suffix
+    { "Bob", 4, 0.5 },       // Inside the name
+    { "m Bob: P", 5, 0.8 },  // Prefix, whole name and suffix
+    { "zzz", 6, 2.0 }        // Nowhere
+};
+
+static char* const names[] = { "Bob", "guide me", "x", "Bguide meob", "Bo", "" };
+
+static void testMatchesRenderedText(God* god, Universe* u, const PrayerIntents* table) {
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        ConsciousEntity* entity = createConsciousEntity(god, u, names[i]);
+        CHECK(entity != NULL);
+        if (!entity) continue;
+
+        TemplatePrayer prayer;
+        CHECK(formTemplatePrayer(entity, &prayer));
+
+        char text[MAX_PRAYER_LENGTH];
+        size_t length = renderTemplatePrayer(&prayer, u, text, sizeof(text));
+        CHECK(length > 0 && length < sizeof(text));
+
+        uint64_t expected = prayerIntentsMatch(table, text);
+        uint64_t matched = prayerIntentsMatchTemplate(table, &prayer, u);
+        if (matched != expected) {
+            fprintf(stderr, "\"%s\": template matched %llx, text %llx\n", text,
+                    (unsigned long long)matched, (unsigned long long)expected);
+        }
+        CHECK(matched == expected);
+
+        // Both paths answer with the same universe
+        Universe* fromText = prayerIntentsRespond(table, entity, text, u);
+        Universe* fromTemplate = prayerIntentsRespondTemplate(table, &prayer, u);
+        CHECK(fromText && fromTemplate);
+        if (fromText && fromTemplate) {
+            CHECK(fromText->totalLifespanDays == fromTemplate->totalLifespanDays);
+            CHECK(fromText->entropyLevel == fromTemplate->entropyLevel);
+        }
+        freeUniverse(fromText);
+        freeUniverse(fromTemplate);
+    }
+}
+
+static void testSpanningPhrases(God* god, Universe* u, const PrayerIntents* table) {
+    char name[] = "Bob";
+    ConsciousEntity* entity = createConsciousEntity(god, u, name);
+    TemplatePrayer prayer;
+    CHECK(entity && formTemplatePrayer(entity, &prayer));
+    if (!entity) return;
+
+    // Every intent but the one in no text
+    CHECK(prayerIntentsMatchTemplate(table, &prayer, u) == 0x1F);
+}
+
+static void testUnknownPrayers(Universe* u, const PrayerIntents* table) {
+    TemplatePrayer unknownTemplate = { PRAYER_TEMPLATE_COUNT, 1 };
+    TemplatePrayer unknownEntity = { PRAYER_TEMPLATE_GUIDANCE, 1000000 };
+    CHECK(prayerIntentsMatchTemplate(table, &unknownTemplate, u) == 0);
+    CHECK(prayerIntentsMatchTemplate(table, &unknownEntity, u) == 0);
+    CHECK(prayerIntentsRespondTemplate(table, &unknownTemplate, u) == NULL);
+    CHECK(prayerIntentsRespondTemplate(table, &unknownEntity, u) == NULL);
+
+    char text[8] = "unused";
+    CHECK(renderTemplatePrayer(&unknownEntity, u, text, sizeof(text)) == 0);
+}
+
+static void testTruncatedRender(God* god, Universe* u) {
+    char name[] = "Eve";
+    ConsciousEntity* entity = createConsciousEntity(god, u, name);
+    TemplatePrayer prayer;
+    CHECK(entity && formTemplatePrayer(entity, &prayer));
+    if (!entity) return;
+
+    char full[MAX_PRAYER_LENGTH];
+    size_t length = renderTemplatePrayer(&prayer, u, full, sizeof(full));
+    CHECK(strcmp(full, "Prayer from Eve: Please guide me.") == 0);
+
+    char cut[10];
+    CHECK(renderTemplatePrayer(&prayer, u, cut, sizeof(cut)) == length);
+    CHECK(strncmp(cut, full, sizeof(cut) - 1) == 0 && cut[sizeof(cut) - 1] == '\0');
+    CHECK(renderTemplatePrayer(&prayer, u, NULL, 0) == length);
+}
+
+int main(void) {
+    God* god = createGod();
+    Universe* u = divineCreateUniverse();
+    PrayerIntents* table = createPrayerIntents(intents, (int)(sizeof(intents) / sizeof(intents[0])));
+    CHECK(god && u && table);
+    if (!god || !u || !table) return CHECK_RESULT();
+
+    testMatchesRenderedText(god, u, table);
+    testSpanningPhrases(god, u, table);
+    testUnknownPrayers(u, table);
+    testTruncatedRender(god, u);
+
+    freePrayerIntents(table);
+    freeUniverse(u);
+    freeGod(god);
+    return CHECK_RESULT();
+}